@@ -0,0 +1,43 @@
+/** \example sample_unweight_csr_digraph1.cpp
+ * This is an example of how to use the unweight::csr_graph class.
+ */
+#include <vector>
+#include "unweight_sparse_multi_graph.hpp"
+#include "unweight_csr_graph.hpp"
+#include "unweight_csr_graph_io.hpp"
+#include "unweight_graph_utils.hpp"
+#include "unweight_digraph_topo_sort.hpp"
+
+using namespace std;
+using namespace unweight;
+
+using Edge = sparse_multi_graph::edge_type;
+
+int main()
+{
+    int vertex_number = 6;
+    vector<Edge> edges = {{0,1}, {0,2}, {1,3}, {2,3}, {3,4}, {3,5}, {4,5}};
+
+    auto graph = make_digraph<sparse_multi_graph>(vertex_number, edges);
+
+    // 从邻接链表表示转换成CSR表示
+    csr_graph csr(*graph);
+
+    cout << csr.vertex_count() << " vertexes, "
+        << csr.edge_count() << " edges in digraph" << endl;
+
+    // show adjLists
+    cout << "csr digraph:\n"
+        << csr
+        << endl;
+
+    for (auto e: get_edges(csr)) {
+        auto [u, v] = e;
+        cout << u << " -> " << v << endl;
+    }
+
+    TopoSort<csr_graph> topo_sort(csr);
+    topo_sort.sort();
+
+    return 0;
+}
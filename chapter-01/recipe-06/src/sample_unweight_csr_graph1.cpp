@@ -0,0 +1,51 @@
+/** \example sample_unweight_csr_graph1.cpp
+ * This is an example of how to use the unweight::csr_graph class.
+ */
+#include <vector>
+#include "unweight_sparse_multi_graph.hpp"
+#include "unweight_csr_graph.hpp"
+#include "unweight_csr_graph_io.hpp"
+#include "unweight_graph_utils.hpp"
+#include "unweight_graph_bfs.hpp"
+#include "unweight_graph_dfs.hpp"
+#include "unweight_graph_ucc.hpp"
+
+using namespace std;
+using namespace unweight;
+
+using Edge = sparse_multi_graph::edge_type;
+
+int main()
+{
+    int vertex_number = 8;
+    vector<Edge> edges = {{0,2}, {0,5}, {0,7}, {1,7}, {2,6}, {3,4}, {3,5}, {4,5}, {4,6}, {4,7}};
+
+    auto graph = make_graph<sparse_multi_graph>(vertex_number, edges);
+
+    // 从邻接链表表示转换成CSR表示
+    csr_graph csr(*graph);
+
+    cout << csr.vertex_count() << " vertexes, "
+        << csr.edge_count() << " edges in graph" << endl;
+
+    // show adjLists
+    cout << "csr graph:\n"
+        << csr
+        << endl;
+
+    for (auto v: get_vertexes(csr)) {
+        cout << "degree(" << v << ") = " << csr.degree(v) << endl;
+    }
+
+    // 图算法可以直接作用于CSR图
+    BFS<csr_graph> bfs(csr);
+    bfs.search(0);
+
+    DFS<csr_graph> dfs(csr);
+    dfs.search(0);
+
+    UCC<csr_graph> ucc(csr);
+    ucc.calculate();
+
+    return 0;
+}
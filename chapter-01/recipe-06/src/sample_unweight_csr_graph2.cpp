@@ -0,0 +1,37 @@
+/** \example sample_unweight_csr_graph2.cpp
+ * This is an example of how to create a unweight::csr_graph from a edge list.
+ */
+#include <vector>
+#include "unweight_csr_graph.hpp"
+#include "unweight_csr_graph_io.hpp"
+#include "unweight_graph_utils.hpp"
+
+using namespace std;
+using namespace unweight;
+
+using Edge = csr_graph::edge_type;
+using Graph = csr_graph;
+
+int main()
+{
+    int vertex_number = 8;
+    vector<Edge> edges = {{0,2}, {0,5}, {0,7}, {1,7}, {2,6}, {3,4}, {3,5}, {4,5}, {4,6}, {4,7}};
+
+    // 一次性从边列表创建CSR图(计数排序), 邻接顶点保持边列表中的顺序
+    auto graph = make_graph<Graph>(vertex_number, edges);
+
+    cout << graph->edge_count() << " edges in graph" << endl;
+    cout << "graph:\n"
+        << *graph
+        << endl;
+
+    // 使用4个线程创建有向图, 邻接顶点的顺序不确定
+    auto digraph = make_digraph<Graph>(vertex_number, edges, 4);
+
+    cout << digraph->edge_count() << " edges in digraph" << endl;
+    for (auto v: get_vertexes(*digraph)) {
+        cout << "out degree(" << v << ") = " << digraph->degree(v) << endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,16 @@
+#!/usr/bin/env bash
+
+echo "./sample_unweight_csr_graph1"
+./sample_unweight_csr_graph1
+
+echo
+echo
+
+echo "./sample_unweight_csr_digraph1"
+./sample_unweight_csr_digraph1
+
+echo
+echo
+
+echo "./sample_unweight_csr_graph2"
+./sample_unweight_csr_graph2
@@ -0,0 +1,35 @@
+/** \example sample_unweight_graph_bfs2.cpp
+ * This is an example of how to get shortest paths from the unweight::BFS class.
+ */
+
+#include <vector>
+#include <iostream>
+#include "unweight_sparse_multi_graph.hpp"
+#include "unweight_graph_utils.hpp"
+#include "unweight_graph_bfs.hpp"
+
+using namespace std;
+using namespace unweight;
+
+using Edge = sparse_multi_graph::edge_type;
+using Graph = sparse_multi_graph;
+
+int main(int argc, char *argv[])
+{
+    int vertex_number = 9;
+    vector<Edge> edges = {{0,2}, {0,5}, {0,7}, {1,7}, {2,6}, {3,4}, {3,5}, {4,5}, {4,6}, {4,7}};
+
+    auto graph = make_graph<Graph>(vertex_number, edges);
+
+    BFS<Graph> bfs(*graph);
+    bfs.search_paths(0);
+
+    for (auto v: get_vertexes(*graph)) {
+        cout << "dist(" << v << ") = " << bfs.distance(v) << ", path:";
+        for (auto w: bfs.path_to(v))
+            cout << " " << w;
+        cout << endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,72 @@
+/** \example sample_unweight_graph_bfs3.cpp
+ * This is an example of how to share a unweight::traversal_workspace between searches.
+ */
+
+#include <vector>
+#include <chrono>
+#include <iostream>
+#include "unweight_csr_graph.hpp"
+#include "unweight_graph_utils.hpp"
+#include "unweight_traversal_workspace.hpp"
+#include "unweight_graph_bfs.hpp"
+#include "unweight_graph_dfs.hpp"
+
+using namespace std;
+using namespace unweight;
+
+using Edge = csr_graph::edge_type;
+using Graph = csr_graph;
+
+int main(int argc, char *argv[])
+{
+    // 1000000个顶点, 由100000个长度为10的环组成
+    int ring_size = 10;
+    int vertex_number = 1000000;
+    vector<Edge> edges;
+    for (int v = 0; v < vertex_number; v++) {
+        int first = v / ring_size * ring_size;
+        edges.push_back(Edge(v, first + (v - first + 1) % ring_size));
+    }
+
+    auto graph = make_graph<Graph>(vertex_number, edges);
+
+    // BFS和DFS共享同一个工作区, 每次搜索只需O(1)时间重置已探索标记
+    traversal_workspace ws(vertex_number);
+    BFS<Graph> bfs(*graph, ws);
+    DFS<Graph> dfs(*graph, ws);
+
+    int query_count = 100000;
+    long long reached = 0;
+    auto start = chrono::steady_clock::now();
+    for (int i = 0; i < query_count; i++) {
+        int s = (i * 7919) % vertex_number;
+        dfs.search(s);
+        bfs.search_paths(s);
+        reached += bfs.path_to((s / ring_size * ring_size + (s + 5) % ring_size)).size();
+    }
+    chrono::duration<double, milli> elapsed = chrono::steady_clock::now() - start;
+
+    cout << query_count << " BFS and DFS queries on " << vertex_number << " vertexes: "
+        << elapsed.count() << " ms, total path length " << reached << endl;
+
+    // 两个BFS对象共享工作区时, 后一次搜索使前一个对象的结果失效
+    auto path = make_graph<Graph>(6, {{0,1}, {1,2}, {3,4}, {4,5}});
+    traversal_workspace shared_ws;
+    BFS<Graph> bfs_a(*path, shared_ws);
+    BFS<Graph> bfs_b(*path, shared_ws);
+    bfs_a.search_paths(0);
+    cout << "a.search_paths(0): a.distance(1) = " << bfs_a.distance(1)
+        << ", a.distance(5) = " << bfs_a.distance(5) << endl;
+    bfs_b.search_paths(3);
+    cout << "b.search_paths(3): a.distance(1) = " << bfs_a.distance(1)
+        << ", a.distance(5) = " << bfs_a.distance(5)
+        << ", a.path_to(5).size() = " << bfs_a.path_to(5).size()
+        << ", b.distance(5) = " << bfs_b.distance(5) << endl;
+    if (bfs_a.distance(1) != -1 || bfs_a.distance(5) != -1 || !bfs_a.path_to(5).empty()
+            || bfs_a.is_visited(0) || bfs_b.distance(5) != 2) {
+        cout << "shared workspace check failed!" << endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,83 @@
+/** \example sample_unweight_graph_bfs4.cpp
+ * This is an example of k-hop neighborhood queries with unweight::BFS.
+ */
+
+#include <vector>
+#include <random>
+#include <chrono>
+#include <iostream>
+#include "unweight_csr_graph.hpp"
+#include "unweight_graph_utils.hpp"
+#include "unweight_traversal_workspace.hpp"
+#include "unweight_graph_bfs.hpp"
+
+using namespace std;
+using namespace unweight;
+
+using Edge = csr_graph::edge_type;
+using Graph = csr_graph;
+
+int main(int argc, char *argv[])
+{
+    // 随机生成一个图: 200000个顶点, 平均度数为6
+    int vertex_number = 200000;
+    int edge_number = vertex_number * 3;
+    mt19937 rand(2020);
+    uniform_int_distribution<int> dist(0, vertex_number-1);
+    vector<Edge> edges;
+    for (int i = 0; i < edge_number; i++) {
+        int v = dist(rand);
+        int w = dist(rand);
+        edges.push_back(Edge(v, w));
+    }
+
+    auto graph = make_graph<Graph>(vertex_number, edges);
+
+    traversal_workspace ws(vertex_number);
+    BFS<Graph> bfs(*graph, ws);
+
+    // 2跳邻域
+    int s = dist(rand);
+    auto neighborhood = bfs.search_within(s, 2);
+    cout << "2-hop neighborhood of " << s << ": " << neighborhood.size() << " vertexes" << endl;
+    for (auto v: neighborhood) {
+        if (bfs.distance(v) == 1)
+            cout << "  " << v << " (1 hop)" << endl;
+    }
+
+    // 3跳邻域中最后探索到的顶点t是否在2跳或3跳之内
+    auto neighborhood3 = bfs.search_within(s, 3);
+    int t = neighborhood3.end()[-1];
+    for (int k = 2; k <= 3; k++) {
+        if (bfs.is_reachable_within(s, t, k)) {
+            cout << t << " is within " << k << " hops of " << s << ", path:";
+            for (auto v: bfs.path_to(t))
+                cout << " " << v;
+            cout << endl;
+        } else {
+            cout << t << " is not within " << k << " hops of " << s << endl;
+        }
+    }
+
+    // 对比完整搜索和有界搜索的耗时
+    int query_count = 100;
+    long long touched = 0;
+    auto start = chrono::steady_clock::now();
+    for (int i = 0; i < query_count; i++) {
+        bfs.search(dist(rand));
+        touched += bfs.visited_vertices().size();
+    }
+    chrono::duration<double, milli> elapsed = chrono::steady_clock::now() - start;
+    cout << query_count << " x search(): " << elapsed.count() << " ms, "
+        << touched / query_count << " vertexes per query" << endl;
+
+    touched = 0;
+    start = chrono::steady_clock::now();
+    for (int i = 0; i < query_count; i++)
+        touched += bfs.search_within(dist(rand), 2).size();
+    elapsed = chrono::steady_clock::now() - start;
+    cout << query_count << " x search_within(s, 2): " << elapsed.count() << " ms, "
+        << touched / query_count << " vertexes per query" << endl;
+
+    return 0;
+}
@@ -5,3 +5,21 @@ echo "./sample_unweight_graph_bfs_dot1 bfs_init.dot bfs.dot"
 dot bfs_init.dot -T png -o bfs_init.png
 dot bfs.dot -T png -o bfs.png
 
+
+echo
+echo
+
+echo "./sample_unweight_graph_bfs2"
+./sample_unweight_graph_bfs2
+
+echo
+echo
+
+echo "./sample_unweight_graph_bfs3"
+./sample_unweight_graph_bfs3
+
+echo
+echo
+
+echo "./sample_unweight_graph_bfs4"
+./sample_unweight_graph_bfs4
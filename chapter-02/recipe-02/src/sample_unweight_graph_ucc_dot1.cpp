@@ -7,8 +7,9 @@
 #include <iostream>
 #include "unweight_sparse_multi_graph.hpp"
 #include "unweight_graph_utils.hpp"
-#include "unweight_graph_ucc_dot.hpp"
+#include "unweight_graph_ucc.hpp"
 #include "unweight_graph_dot.hpp"
+#include "unweight_graph_trace_dot.hpp"
 
 using namespace std;
 using namespace unweight;
@@ -41,8 +42,9 @@ int main(int argc, char *argv[])
 
     save_dot_file(argv[1], *graph, vmap);
 
-    UCC<Graph> ucc(*graph);
-    ucc.calculate_and_save_dotfile(argv[2], vmap);
+    UCC<Graph, trace_visitor> ucc(*graph);
+    ucc.calculate();
+    save_ucc_dot_file(argv[2], *graph, ucc.visitor(), vmap);
 
     return 0;
 }
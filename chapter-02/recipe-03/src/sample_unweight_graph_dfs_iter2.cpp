@@ -0,0 +1,55 @@
+/** \example sample_unweight_graph_dfs_iter2.cpp
+ * This is an example of how to use the unweight::DFS class.
+ */
+
+#include <vector>
+#include <iostream>
+#include "unweight_sparse_multi_graph.hpp"
+#include "unweight_csr_graph.hpp"
+#include "unweight_graph_utils.hpp"
+#include "unweight_graph_dfs_iter.hpp"
+
+using namespace std;
+using namespace unweight;
+
+using Edge = sparse_multi_graph::edge_type;
+using Graph = sparse_multi_graph;
+
+int main(int argc, char *argv[])
+{
+    int vertex_number = 8;
+    vector<Edge> edges = {{0,2}, {0,5}, {0,7}, {1,7}, {2,6}, {3,4}, {3,5}, {4,5}, {4,6}, {4,7}};
+
+    auto graph = make_graph<Graph>(vertex_number, edges);
+
+    DFS<Graph> dfs(*graph);
+    dfs.search(0);
+
+    cout << "pre-order:";
+    for (auto v: dfs.pre_order())
+        cout << " " << v;
+    cout << endl;
+
+    cout << "post-order:";
+    for (auto v: dfs.post_order())
+        cout << " " << v;
+    cout << endl;
+
+    for (auto v: get_vertexes(*graph)) {
+        cout << "  " << v << ": " << dfs.discover_time(v) << "/" << dfs.finish_time(v) << endl;
+    }
+
+    // 星形图: 中心顶点的度数为1000000, 堆栈中最多只有两帧
+    vertex_number = 1000001;
+    edges.clear();
+    for (int v = 1; v < vertex_number; v++)
+        edges.push_back({0, v});
+    auto star = make_graph<csr_graph>(vertex_number, edges);
+
+    DFS<csr_graph> star_dfs(*star);
+    star_dfs.search(1);
+    cout << "star of " << vertex_number << " vertexes: " << star_dfs.pre_order().size()
+        << " visited, finish time of center: " << star_dfs.finish_time(0) << endl;
+
+    return 0;
+}
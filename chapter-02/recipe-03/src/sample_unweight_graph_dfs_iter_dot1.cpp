@@ -7,8 +7,9 @@
 #include <iostream>
 #include "unweight_sparse_multi_graph.hpp"
 #include "unweight_graph_utils.hpp"
-#include "unweight_graph_dfs_iter_dot.hpp"
+#include "unweight_graph_dfs_iter.hpp"
 #include "unweight_graph_dot.hpp"
+#include "unweight_graph_trace_dot.hpp"
 
 using namespace std;
 using namespace unweight;
@@ -41,8 +42,9 @@ int main(int argc, char *argv[])
 
     save_dot_file(argv[1], *graph, vmap);
 
-    DFS<Graph> dfs(*graph);
-    dfs.search_and_save_dotfile(0, argv[2], vmap);
+    DFS<Graph, trace_visitor> dfs(*graph);
+    dfs.search(0);
+    save_dfs_dot_file(argv[2], *graph, dfs.visitor(), vmap);
 
     return 0;
 }
@@ -5,3 +5,15 @@ echo "./sample_unweight_graph_dfs_iter_dot1 dfs_init.dot dfs.dot"
 dot dfs_init.dot -T png -o dfs_init.png
 dot dfs.dot -T png -o dfs.png
 
+
+echo
+echo
+
+echo "./sample_unweight_graph_dfs_iter1"
+./sample_unweight_graph_dfs_iter1
+
+echo
+echo
+
+echo "./sample_unweight_graph_dfs_iter2"
+./sample_unweight_graph_dfs_iter2
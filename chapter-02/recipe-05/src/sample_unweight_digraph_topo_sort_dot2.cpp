@@ -7,8 +7,9 @@
 #include <iostream>
 #include "unweight_sparse_multi_graph.hpp"
 #include "unweight_graph_utils.hpp"
-#include "unweight_digraph_topo_sort_dot.hpp"
+#include "unweight_digraph_topo_sort.hpp"
 #include "unweight_graph_dot.hpp"
+#include "unweight_graph_trace_dot.hpp"
 
 using namespace std;
 using namespace unweight;
@@ -50,8 +51,9 @@ int main(int argc, char *argv[])
 
     save_dot_file(argv[1], *graph, vmap);
 
-    TopoSort<Graph> topo_sort(*graph);
-    topo_sort.sort_and_save_dotfile(argv[2], vmap);
+    TopoSort<Graph, trace_visitor> topo_sort(*graph);
+    topo_sort.sort();
+    save_topo_sort_dot_file(argv[2], *graph, topo_sort.visitor(), vmap);
 
     return 0;
 }
@@ -0,0 +1,57 @@
+/** \example sample_unweight_digraph_topo_sort_iter1.cpp
+ * This is an example of how to use the unweight::TopoSort class (iterative version).
+ */
+
+#include <vector>
+#include <iostream>
+#include "unweight_sparse_multi_graph.hpp"
+#include "unweight_graph_utils.hpp"
+#include "unweight_digraph_topo_sort_iter.hpp"
+
+using namespace std;
+using namespace unweight;
+
+using Edge = sparse_multi_graph::edge_type;
+using Graph = sparse_multi_graph;
+
+int main(int argc, char *argv[])
+{
+    // 有向无环图
+    int vertex_number = 4;
+    vector<Edge> edges = {{0,1}, {0,2}, {1,3}, {2,3}};
+
+    auto graph = make_digraph<Graph>(vertex_number, edges);
+
+    TopoSort<Graph> topo_sort(*graph);
+    if (topo_sort.sort()) {
+        cout << "order:";
+        for (auto v: topo_sort.order())
+            cout << " " << v;
+        cout << endl;
+    }
+
+    // 添加边3->1以后出现环1->3->1
+    graph->insert(Edge(3, 1));
+    if (!topo_sort.sort()) {
+        cout << "cycle:";
+        for (auto v: topo_sort.cycle())
+            cout << " " << v;
+        cout << endl;
+    }
+
+    // 1000000个顶点的链, 递归版本会导致栈溢出
+    vertex_number = 1000000;
+    edges.clear();
+    for (int v = 0; v+1 < vertex_number; v++)
+        edges.push_back(Edge(v, v+1));
+
+    auto chain = make_digraph<Graph>(vertex_number, edges);
+
+    TopoSort<Graph> chain_sort(*chain);
+    if (chain_sort.sort()) {
+        cout << "chain: first = " << chain_sort.order().front()
+            << ", last = " << chain_sort.order().back() << endl;
+    }
+
+    return 0;
+}
@@ -10,3 +10,5 @@ echo "./sample_unweight_digraph_topo_sort_dot2 gets_dressed_init.dot gets_dresse
 dot gets_dressed_init.dot -T png -o gets_dressed_init.png
 dot gets_dressed.dot -T png -o gets_dressed.png
 
+echo "./sample_unweight_digraph_topo_sort_iter1"
+./sample_unweight_digraph_topo_sort_iter1
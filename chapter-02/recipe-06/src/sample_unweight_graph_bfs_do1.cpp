@@ -0,0 +1,61 @@
+/** \example sample_unweight_graph_bfs_do1.cpp
+ * This is an example of how to use the unweight::DirectionOptimizingBFS class.
+ */
+
+#include <vector>
+#include <random>
+#include <iostream>
+#include "unweight_csr_graph.hpp"
+#include "unweight_graph_utils.hpp"
+#include "unweight_graph_bfs.hpp"
+#include "unweight_graph_do_bfs.hpp"
+
+using namespace std;
+using namespace unweight;
+
+using Edge = csr_graph::edge_type;
+using Graph = csr_graph;
+
+int main(int argc, char *argv[])
+{
+    // 随机生成一个低直径的图: 100000个顶点, 平均度数为16
+    int vertex_number = 100000;
+    int edge_number = vertex_number * 8;
+    mt19937 rand(2020);
+    uniform_int_distribution<int> dist(0, vertex_number-1);
+    vector<Edge> edges;
+    for (int i = 0; i < edge_number; i++) {
+        int v = dist(rand);
+        int w = dist(rand);
+        edges.push_back(Edge(v, w));
+    }
+
+    for (bool directed: {false, true}) {
+        auto graph = directed ? make_digraph<Graph>(vertex_number, edges) :
+                                make_graph<Graph>(vertex_number, edges);
+
+        BFS<Graph> bfs1(*graph);
+        bfs1.search(0);
+
+        DirectionOptimizingBFS<Graph> bfs2(*graph);
+        bfs2.search(0);
+
+        int reached1 = 0, reached2 = 0;
+        long long checks1 = 0;
+        for (auto v: get_vertexes(*graph)) {
+            if (bfs1.is_visited(v)) {
+                reached1++;
+                checks1 += graph->degree(v);    // 自顶向下的BFS会检查所有可达顶点的所有边
+            }
+            if (bfs2.is_visited(v)) reached2++;
+        }
+
+        cout << (directed ? "digraph" : "graph") << ":\n"
+            << "  top-down BFS:             reached " << reached1
+            << " vertexes, checked " << checks1 << " edges\n"
+            << "  direction-optimizing BFS: reached " << reached2
+            << " vertexes, checked " << bfs2.edge_checks() << " edges\n";
+    }
+
+    return 0;
+}
@@ -0,0 +1,4 @@
+#!/usr/bin/env bash
+
+echo "./sample_unweight_graph_bfs_do1"
+./sample_unweight_graph_bfs_do1
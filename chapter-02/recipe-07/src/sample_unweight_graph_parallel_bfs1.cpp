@@ -0,0 +1,65 @@
+/** \example sample_unweight_graph_parallel_bfs1.cpp
+ * This is an example of how to use the unweight::ParallelBFS class.
+ */
+
+#include <vector>
+#include <random>
+#include <chrono>
+#include <iostream>
+#include "unweight_csr_graph.hpp"
+#include "unweight_graph_utils.hpp"
+#include "unweight_graph_bfs.hpp"
+#include "unweight_graph_parallel_bfs.hpp"
+
+using namespace std;
+using namespace unweight;
+
+using Edge = csr_graph::edge_type;
+using Graph = csr_graph;
+
+int main(int argc, char *argv[])
+{
+    // 随机生成一个图: 1000000个顶点, 平均度数为16
+    int vertex_number = 1000000;
+    int edge_number = vertex_number * 8;
+    mt19937 rand(2020);
+    uniform_int_distribution<int> dist(0, vertex_number-1);
+    vector<Edge> edges;
+    for (int i = 0; i < edge_number; i++) {
+        int v = dist(rand);
+        int w = dist(rand);
+        edges.push_back(Edge(v, w));
+    }
+
+    auto graph = make_graph<Graph>(vertex_number, edges, parallel::default_thread_count());
+
+    auto start = chrono::steady_clock::now();
+    BFS<Graph> bfs(*graph);
+    bfs.search(0);
+    chrono::duration<double, milli> elapsed = chrono::steady_clock::now() - start;
+    cout << "BFS: " << elapsed.count() << " ms" << endl;
+
+    for (int thread_count = 1; thread_count <= parallel::default_thread_count(); thread_count *= 2) {
+        ParallelBFS<Graph> parallel_bfs(*graph, thread_count);
+
+        start = chrono::steady_clock::now();
+        parallel_bfs.search(0);
+        elapsed = chrono::steady_clock::now() - start;
+
+        // 检查结果与BFS相同
+        bool same = true;
+        for (auto v: get_vertexes(*graph)) {
+            if (bfs.is_visited(v) != parallel_bfs.is_visited(v)) {
+                same = false;
+                break;
+            }
+        }
+
+        cout << "ParallelBFS(" << thread_count << " threads): " << elapsed.count() << " ms, "
+            << parallel_bfs.reached().size() << " vertexes in "
+            << parallel_bfs.level_count() << " levels, "
+            << (same ? "same as BFS" : "different from BFS") << endl;
+    }
+
+    return 0;
+}
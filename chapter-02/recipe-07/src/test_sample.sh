@@ -0,0 +1,4 @@
+#!/usr/bin/env bash
+
+echo "./sample_unweight_graph_parallel_bfs1"
+./sample_unweight_graph_parallel_bfs1
@@ -0,0 +1,88 @@
+/** \example sample_unweight_graph_ms_bfs1.cpp
+ * This is an example of how to use the unweight::MultiSourceBFS class.
+ */
+
+#include <vector>
+#include <random>
+#include <chrono>
+#include <iostream>
+#include "unweight_csr_graph.hpp"
+#include "unweight_graph_utils.hpp"
+#include "unweight_graph_bfs.hpp"
+#include "unweight_graph_ms_bfs.hpp"
+
+using namespace std;
+using namespace unweight;
+
+using Edge = csr_graph::edge_type;
+using Graph = csr_graph;
+
+int main(int argc, char *argv[])
+{
+    // 随机生成一个图: 50000个顶点, 平均度数为8
+    int vertex_number = 50000;
+    int edge_number = vertex_number * 4;
+    mt19937 rand(2020);
+    uniform_int_distribution<int> dist(0, vertex_number-1);
+    vector<Edge> edges;
+    for (int i = 0; i < edge_number; i++) {
+        int v = dist(rand);
+        int w = dist(rand);
+        edges.push_back(Edge(v, w));
+    }
+
+    auto graph = make_graph<Graph>(vertex_number, edges);
+
+    // 256个起点
+    vector<int> sources;
+    for (int i = 0; i < 256; i++)
+        sources.push_back(dist(rand));
+
+    // 逐个起点进行BFS, 计算每个起点到其他顶点的跳数之和
+    auto start = chrono::steady_clock::now();
+    BFS<Graph> bfs(*graph);
+    vector<long long> sums;
+    for (auto s: sources) {
+        bfs.search_paths(s);
+        long long sum = 0;
+        for (auto v: get_vertexes(*graph)) {
+            if (bfs.is_visited(v)) sum += bfs.distance(v);
+        }
+        sums.push_back(sum);
+    }
+    chrono::duration<double, milli> elapsed = chrono::steady_clock::now() - start;
+    cout << "256 x BFS: " << elapsed.count() << " ms" << endl;
+
+    // 每批64个起点
+    start = chrono::steady_clock::now();
+    MultiSourceBFS<Graph> ms_bfs64(*graph);
+    bool same = true;
+    for (int first = 0; first < (int) sources.size(); first += 64) {
+        vector<int> batch(sources.begin()+first, sources.begin()+first+64);
+        ms_bfs64.search(batch);
+        for (int i = 0; i < 64; i++)
+            same = same && (ms_bfs64.distance_sum(i) == sums[first+i]);
+    }
+    elapsed = chrono::steady_clock::now() - start;
+    cout << "4 x MultiSourceBFS<Graph, 1>: " << elapsed.count() << " ms, "
+        << (same ? "same as BFS" : "different from BFS") << endl;
+
+    // 一批256个起点
+    start = chrono::steady_clock::now();
+    MultiSourceBFS<Graph, 4> ms_bfs256(*graph);
+    ms_bfs256.search(sources);
+    same = true;
+    for (int i = 0; i < (int) sources.size(); i++)
+        same = same && (ms_bfs256.distance_sum(i) == sums[i]);
+    elapsed = chrono::steady_clock::now() - start;
+    cout << "1 x MultiSourceBFS<Graph, 4>: " << elapsed.count() << " ms, "
+        << (same ? "same as BFS" : "different from BFS") << endl;
+
+    // 接近中心性(closeness centrality) = (可达顶点数-1) / 跳数之和
+    for (int i = 0; i < 4; i++) {
+        cout << "closeness(" << sources[i] << ") = "
+            << (ms_bfs256.reached_count(i) - 1) / double(ms_bfs256.distance_sum(i)) << endl;
+    }
+
+    return 0;
+}
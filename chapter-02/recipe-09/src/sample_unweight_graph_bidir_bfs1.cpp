@@ -0,0 +1,60 @@
+/** \example sample_unweight_graph_bidir_bfs1.cpp
+ * This is an example of how to use the unweight::BidirectionalBFS class.
+ */
+
+#include <vector>
+#include <random>
+#include <iostream>
+#include "unweight_csr_graph.hpp"
+#include "unweight_graph_utils.hpp"
+#include "unweight_graph_bfs.hpp"
+#include "unweight_graph_bidir_bfs.hpp"
+
+using namespace std;
+using namespace unweight;
+
+using Edge = csr_graph::edge_type;
+using Graph = csr_graph;
+
+int main(int argc, char *argv[])
+{
+    // 随机生成一个图: 100000个顶点, 平均度数为8
+    int vertex_number = 100000;
+    int edge_number = vertex_number * 4;
+    mt19937 rand(2020);
+    uniform_int_distribution<int> dist(0, vertex_number-1);
+    vector<Edge> edges;
+    for (int i = 0; i < edge_number; i++) {
+        int v = dist(rand);
+        int w = dist(rand);
+        edges.push_back(Edge(v, w));
+    }
+
+    auto graph = make_graph<Graph>(vertex_number, edges);
+
+    BFS<Graph> bfs(*graph);
+    BidirectionalBFS<Graph> bidir_bfs(*graph);
+    for (int i = 0; i < 4; i++) {
+        int s = dist(rand);
+        int t = dist(rand);
+
+        // 单向BFS需要探索整个连通分量
+        bfs.search_paths(s);
+        long long bfs_edges = 0;
+        for (auto v: get_vertexes(*graph)) {
+            if (bfs.is_visited(v)) bfs_edges += graph->degree(v);
+        }
+
+        auto path = bidir_bfs.shortest_path(s, t);
+        cout << s << " -> " << t << ": hop count = " << bidir_bfs.hop_count()
+            << " (BFS: " << bfs.distance(t) << ")" << endl;
+        cout << "  path:";
+        for (auto v: path)
+            cout << " " << v;
+        cout << endl;
+        cout << "  edge checks: BFS = " << bfs_edges
+            << ", BidirectionalBFS = " << bidir_bfs.edge_checks() << endl;
+    }
+
+    return 0;
+}
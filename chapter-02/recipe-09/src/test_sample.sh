@@ -0,0 +1,4 @@
+#!/usr/bin/env bash
+
+echo "./sample_unweight_graph_bidir_bfs1"
+./sample_unweight_graph_bidir_bfs1
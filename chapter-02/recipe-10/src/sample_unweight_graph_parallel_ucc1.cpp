@@ -0,0 +1,57 @@
+/** \example sample_unweight_graph_parallel_ucc1.cpp
+ * This is an example of how to use the unweight::ParallelUCC class.
+ */
+
+#include <vector>
+#include <random>
+#include <chrono>
+#include <iostream>
+#include "unweight_csr_graph.hpp"
+#include "unweight_graph_utils.hpp"
+#include "unweight_graph_ucc.hpp"
+#include "unweight_graph_parallel_ucc.hpp"
+
+using namespace std;
+using namespace unweight;
+
+using Edge = csr_graph::edge_type;
+using Graph = csr_graph;
+
+int main(int argc, char *argv[])
+{
+    // 随机生成一个图: 500000个顶点, 平均度数为4, 除了一个最大连通分量之外还有很多小的连通分量
+    int vertex_number = 500000;
+    int edge_number = vertex_number * 2;
+    mt19937 rand(2020);
+    uniform_int_distribution<int> dist(0, vertex_number-1);
+    vector<Edge> edges;
+    for (int i = 0; i < edge_number; i++) {
+        int v = dist(rand);
+        int w = dist(rand);
+        edges.push_back(Edge(v, w));
+    }
+
+    auto graph = make_graph<Graph>(vertex_number, edges);
+
+    auto start = chrono::steady_clock::now();
+    UCC<Graph> ucc(*graph);
+    ucc.calculate();
+    chrono::duration<double, milli> elapsed = chrono::steady_clock::now() - start;
+    cout << "UCC: " << ucc.count() << " components, " << elapsed.count() << " ms" << endl;
+
+    for (int thread_count: {1, 2, 4}) {
+        start = chrono::steady_clock::now();
+        ParallelUCC<Graph> parallel_ucc(*graph, thread_count);
+        parallel_ucc.calculate();
+        elapsed = chrono::steady_clock::now() - start;
+
+        bool same = parallel_ucc.count() == ucc.count();
+        for (auto v: get_vertexes(*graph))
+            same = same && (parallel_ucc.id(v) == ucc.id(v));
+        cout << "ParallelUCC(" << thread_count << " threads): " << parallel_ucc.count()
+            << " components, " << elapsed.count() << " ms, "
+            << (same ? "same as UCC" : "different from UCC") << endl;
+    }
+
+    return 0;
+}
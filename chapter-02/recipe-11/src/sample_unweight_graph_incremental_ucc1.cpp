@@ -0,0 +1,81 @@
+/** \example sample_unweight_graph_incremental_ucc1.cpp
+ * This is an example of how to use the unweight::IncrementalUCC class.
+ */
+
+#include <vector>
+#include <random>
+#include <chrono>
+#include <iostream>
+#include "unweight_sparse_multi_graph.hpp"
+#include "unweight_graph_utils.hpp"
+#include "unweight_graph_ucc.hpp"
+#include "unweight_graph_incremental_ucc.hpp"
+
+using namespace std;
+using namespace unweight;
+
+using Edge = sparse_multi_graph::edge_type;
+using Graph = sparse_multi_graph;
+
+int main(int argc, char *argv[])
+{
+    // 从10个顶点的图开始, 逐条插入边
+    auto graph = make_graph<Graph>(10, {{0,2}, {0,4}, {1,3}});
+    IncrementalUCC<Graph> ucc(*graph);
+    cout << "components: " << ucc.count() << endl;
+
+    vector<Edge> edges = {{2,4}, {4,6}, {4,8}, {5,7}, {5,9}, {3,9}};
+    for (auto e: edges) {
+        ucc.insert(e);
+        cout << "insert " << get<0>(e) << "-" << get<1>(e) << ": components = " << ucc.count()
+            << ", connected(1, 7) = " << (ucc.connected(1, 7) ? "true" : "false") << endl;
+    }
+
+    // 随机插入边的流, 与每次重新计算UCC对比
+    int vertex_number = 20000;
+    int edge_number = 20000;
+    mt19937 rand(2020);
+    uniform_int_distribution<int> dist(0, vertex_number-1);
+
+    auto graph1 = make_graph<Graph>(vertex_number, {});
+    IncrementalUCC<Graph> incremental(*graph1);
+    auto graph2 = make_graph<Graph>(vertex_number, {});
+    UCC<Graph> ucc2(*graph2);
+
+    bool same = true;
+    auto start = chrono::steady_clock::now();
+    for (int i = 0; i < edge_number; i++) {
+        int v = dist(rand);
+        int w = dist(rand);
+        Edge e(v, w);
+        incremental.insert(e);
+        same = same && incremental.connected(get<0>(e), get<1>(e));
+    }
+    chrono::duration<double, milli> elapsed = chrono::steady_clock::now() - start;
+    cout << edge_number << " x IncrementalUCC::insert(): " << elapsed.count() << " ms, "
+        << incremental.count() << " components" << endl;
+
+    rand.seed(2020);
+    start = chrono::steady_clock::now();
+    for (int i = 0; i < edge_number; i++) {
+        int v = dist(rand);
+        int w = dist(rand);
+        Edge e(v, w);
+        graph2->insert(e);
+        if (i % 100 == 99)
+            ucc2.calculate();
+    }
+    ucc2.calculate();
+    elapsed = chrono::steady_clock::now() - start;
+    cout << edge_number / 100 << " x UCC::calculate(): " << elapsed.count() << " ms, "
+        << ucc2.count() << " components" << endl;
+
+    for (auto v: get_vertexes(*graph1)) {
+        for (auto w: {0, 1, 2}) {
+            same = same && (incremental.connected(v, w) == ucc2.connected(v, w));
+        }
+    }
+    cout << (same ? "same as UCC" : "different from UCC") << endl;
+
+    return 0;
+}
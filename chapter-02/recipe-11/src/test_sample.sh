@@ -0,0 +1,4 @@
+#!/usr/bin/env bash
+
+echo "./sample_unweight_graph_incremental_ucc1"
+./sample_unweight_graph_incremental_ucc1
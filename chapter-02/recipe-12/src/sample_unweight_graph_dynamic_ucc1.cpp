@@ -0,0 +1,85 @@
+/** \example sample_unweight_graph_dynamic_ucc1.cpp
+ * This is an example of how to use the unweight::DynamicUCC class.
+ */
+
+#include <vector>
+#include <random>
+#include <chrono>
+#include <iostream>
+#include "unweight_sparse_multi_graph.hpp"
+#include "unweight_graph_utils.hpp"
+#include "unweight_graph_ucc.hpp"
+#include "unweight_graph_dynamic_ucc.hpp"
+
+using namespace std;
+using namespace unweight;
+
+using Edge = sparse_multi_graph::edge_type;
+using Graph = sparse_multi_graph;
+
+int main(int argc, char *argv[])
+{
+    // 一个环和一条弦: 删除环上的边时, 连通分量不变
+    auto graph = make_graph<Graph>(6, {{0,1}, {1,2}, {2,3}, {3,0}, {0,2}, {4,5}});
+    DynamicUCC<Graph> ucc(*graph);
+    cout << "components: " << ucc.count() << endl;
+
+    vector<Edge> removed = {{0,1}, {2,3}, {0,2}, {4,5}};
+    for (auto e: removed) {
+        ucc.remove(e);
+        cout << "remove " << get<0>(e) << "-" << get<1>(e) << ": components = " << ucc.count()
+            << ", connected(0, 3) = " << (ucc.connected(0, 3) ? "true" : "false")
+            << ", size(1) = " << ucc.component_size(1) << endl;
+    }
+
+    // 随机插入和删除边, 与每次重新计算UCC对比
+    int vertex_number = 10000;
+    int update_number = 50000;
+    mt19937 rand(2020);
+    uniform_int_distribution<int> dist(0, vertex_number-1);
+
+    auto graph1 = make_graph<Graph>(vertex_number, {});
+    DynamicUCC<Graph> dynamic(*graph1);
+    vector<Edge> live;
+
+    bool same = true;
+    long long update_ns = 0;
+    long long ucc_ns = 0;
+    for (int i = 0; i < update_number; i++) {
+        auto start = chrono::steady_clock::now();
+        if (live.size() < (size_t) vertex_number || rand() % 2 == 0) {
+            int v = dist(rand);
+            int w = dist(rand);
+            Edge e(v, w);
+            dynamic.insert(e);
+            live.push_back(e);
+        } else {
+            int k = rand() % live.size();
+            dynamic.remove(live[k]);
+            live[k] = live.back();
+            live.pop_back();
+        }
+        update_ns += chrono::nanoseconds(chrono::steady_clock::now() - start).count();
+
+        if (i % 1000 == 999) {
+            start = chrono::steady_clock::now();
+            UCC<Graph> ucc1(*graph1);
+            ucc1.calculate();
+            ucc_ns += chrono::nanoseconds(chrono::steady_clock::now() - start).count();
+
+            same = same && (ucc1.count() == dynamic.count());
+            for (int j = 0; j < 100; j++) {
+                int u = dist(rand);
+                int v = dist(rand);
+                same = same && (ucc1.connected(u, v) == dynamic.connected(u, v));
+            }
+        }
+    }
+
+    cout << update_number << " updates, " << dynamic.count() << " components" << endl;
+    cout << "average DynamicUCC update: " << update_ns / 1000.0 / update_number << " us" << endl;
+    cout << "average UCC::calculate(): " << ucc_ns / 1000.0 / (update_number / 1000) << " us" << endl;
+    cout << (same ? "same as UCC" : "different from UCC") << endl;
+
+    return 0;
+}
@@ -0,0 +1,84 @@
+/** \example sample_unweight_digraph_parallel_topo_sort1.cpp
+ * This is an example of how to use the unweight::ParallelTopoSort class.
+ */
+
+#include <string>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <iostream>
+#include "unweight_sparse_multi_graph.hpp"
+#include "unweight_csr_graph.hpp"
+#include "unweight_graph_utils.hpp"
+#include "unweight_digraph_parallel_topo_sort.hpp"
+
+using namespace std;
+using namespace unweight;
+
+int main(int argc, char *argv[])
+{
+    using Edge = sparse_multi_graph::edge_type;
+    using Graph = sparse_multi_graph;
+
+    vector<string> vmap = {"内裤",  // 0
+                           "裤子",  // 1
+                           "腰带",  // 2
+                           "衬衣",  // 3
+                           "领带",  // 4
+                           "夹克",  // 5
+                           "袜子",  // 6
+                           "鞋",    // 7
+                           "手表",  // 8
+                           };
+    vector<Edge> edges = {
+                            {0, 1}, // 内裤 -> 裤子
+                            {0, 7}, // 内裤 -> 鞋
+                            {6, 7}, // 袜子 -> 鞋
+                            {1, 7}, // 裤子 -> 鞋
+                            {1, 2}, // 裤子 -> 腰带
+                            {3, 2}, // 衬衣 -> 腰带
+                            {3, 4}, // 衬衣 -> 领带
+                            {4, 5}, // 领带 -> 夹克
+                            {2, 5}, // 腰带 -> 夹克
+                         };
+    int vertex_number = vmap.size();
+
+    auto graph = make_digraph<Graph>(vertex_number, edges);
+
+    // 每一层的衣服可以同时穿
+    ParallelTopoSort<Graph> topo_sort(*graph, 2);
+    topo_sort.sort();
+    for (int i = 0; i < topo_sort.level_count(); i++) {
+        cout << "level " << i << ":";
+        for (auto v: topo_sort.level(i))
+            cout << " " << vmap[v];
+        cout << endl;
+    }
+
+    // 有环时返回false
+    graph->insert(Edge(5, 3));   // 夹克 -> 衬衣
+    if (!topo_sort.sort())
+        cout << "cycle detected, " << topo_sort.order().size() << " vertexes sorted" << endl;
+
+    // 随机生成一个有向无环图: 1000000个顶点, 每个顶点有4条指向编号更大的顶点的出边
+    int dag_vertex_number = 1000000;
+    mt19937 rand(2020);
+    vector<csr_graph::edge_type> dag_edges;
+    for (int v = 0; v < dag_vertex_number - 1; v++) {
+        uniform_int_distribution<int> dist(v+1, min(v+100000, dag_vertex_number-1));
+        for (int i = 0; i < 4; i++)
+            dag_edges.push_back(csr_graph::edge_type(v, dist(rand)));
+    }
+    auto dag = make_digraph<csr_graph>(dag_vertex_number, dag_edges);
+
+    for (int thread_count: {1, 2, 4}) {
+        auto start = chrono::steady_clock::now();
+        ParallelTopoSort<csr_graph> dag_sort(*dag, thread_count);
+        dag_sort.sort();
+        chrono::duration<double, milli> elapsed = chrono::steady_clock::now() - start;
+        cout << "ParallelTopoSort(" << thread_count << " threads): " << dag_sort.level_count()
+            << " levels, " << elapsed.count() << " ms" << endl;
+    }
+
+    return 0;
+}
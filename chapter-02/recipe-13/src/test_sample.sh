@@ -0,0 +1,4 @@
+#!/usr/bin/env bash
+
+echo "./sample_unweight_digraph_parallel_topo_sort1"
+./sample_unweight_digraph_parallel_topo_sort1
@@ -0,0 +1,93 @@
+/** \example sample_unweight_digraph_dynamic_topo_sort1.cpp
+ * This is an example of how to use the unweight::DynamicTopoSort class.
+ */
+
+#include <vector>
+#include <random>
+#include <chrono>
+#include <iostream>
+#include "unweight_sparse_multi_graph.hpp"
+#include "unweight_graph_utils.hpp"
+#include "unweight_digraph_topo_sort_iter.hpp"
+#include "unweight_digraph_dynamic_topo_sort.hpp"
+
+using namespace std;
+using namespace unweight;
+
+using Edge = sparse_multi_graph::edge_type;
+using Graph = sparse_multi_graph;
+
+void print_order(const DynamicTopoSort<Graph> &topo_sort)
+{
+    cout << "  order:";
+    for (auto v: topo_sort.order())
+        cout << " " << v;
+    cout << endl;
+}
+
+int main(int argc, char *argv[])
+{
+    int vertex_number = 6;
+    auto graph = make_digraph<Graph>(vertex_number, {{0,1}, {1,2}, {3,4}});
+
+    DynamicTopoSort<Graph> topo_sort(*graph);
+    print_order(topo_sort);
+
+    vector<Edge> edges = {{2,3}, {5,0}, {4,1}, {4,5}};
+    for (auto e: edges) {
+        bool ok = topo_sort.insert(e);
+        cout << "insert " << get<0>(e) << "->" << get<1>(e) << ": "
+            << (ok ? "ok" : "rejected, would create a cycle")
+            << ", affected vertexes = " << topo_sort.affected_count() << endl;
+        print_order(topo_sort);
+    }
+
+    // 构造时的图有环, 不是有效的拓扑顺序, 拒绝插入任何边
+    auto cyclic = make_digraph<Graph>(4, {{0,1}, {1,2}, {2,0}});
+    DynamicTopoSort<Graph> cyclic_sort(*cyclic);
+    bool ok = cyclic_sort.insert(Edge(2,3));
+    cout << "cyclic graph: acyclic = " << (cyclic_sort.is_acyclic() ? "yes" : "no")
+        << ", insert 2->3: " << (ok ? "ok" : "rejected") << ", edges = " << cyclic->edge_count() << endl;
+    if (ok || cyclic->edge_count() != 3) {
+        cout << "cyclic graph check failed!" << endl;
+        return 1;
+    }
+
+    // 随机插入边, 与每次重新排序对比
+    vertex_number = 20000;
+    int edge_number = 20000;
+    mt19937 rand(2020);
+    uniform_int_distribution<int> dist(0, vertex_number-1);
+
+    auto graph1 = make_digraph<Graph>(vertex_number, {});
+    DynamicTopoSort<Graph> dynamic(*graph1);
+    int rejected = 0;
+    long long affected = 0;
+    auto start = chrono::steady_clock::now();
+    for (int i = 0; i < edge_number; i++) {
+        int v = dist(rand);
+        int w = dist(rand);
+        if (!dynamic.insert(Edge(v, w)))
+            rejected++;
+        affected += dynamic.affected_count();
+    }
+    chrono::duration<double, milli> elapsed = chrono::steady_clock::now() - start;
+    cout << edge_number << " x DynamicTopoSort::insert(): " << elapsed.count() << " ms, "
+        << rejected << " rejected, " << affected / double(edge_number) << " affected vertexes per insert" << endl;
+
+    start = chrono::steady_clock::now();
+    TopoSort<Graph> topo_sort1(*graph1);
+    for (int i = 0; i < 100; i++)
+        topo_sort1.sort();
+    elapsed = chrono::steady_clock::now() - start;
+    cout << "100 x TopoSort::sort(): " << elapsed.count() << " ms" << endl;
+
+    bool valid = true;
+    for (auto v: get_vertexes(*graph1)) {
+        for (auto w: graph1->get_adj_list(v))
+            valid = valid && dynamic.position(v) < dynamic.position(w);
+    }
+    cout << (valid ? "valid topological order" : "invalid topological order") << endl;
+
+    return 0;
+}
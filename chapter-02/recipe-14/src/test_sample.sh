@@ -0,0 +1,4 @@
+#!/usr/bin/env bash
+
+echo "./sample_unweight_digraph_dynamic_topo_sort1"
+./sample_unweight_digraph_dynamic_topo_sort1
@@ -0,0 +1,70 @@
+/** \example sample_unweight_digraph_scc1.cpp
+ * This is an example of how to use the unweight::SCC class.
+ */
+
+#include <vector>
+#include <iostream>
+#include "unweight_sparse_multi_graph.hpp"
+#include "unweight_dense_graph.hpp"
+#include "unweight_csr_graph.hpp"
+#include "unweight_graph_utils.hpp"
+#include "unweight_digraph_scc.hpp"
+
+using namespace std;
+using namespace unweight;
+
+template <typename Graph>
+void print_scc(const Graph &graph)
+{
+    SCC<Graph> scc(graph);
+    scc.calculate();
+
+    cout << scc.count() << " strongly connected components" << endl;
+    for (int c = 0; c < scc.count(); c++) {
+        cout << "  " << c << ":";
+        for (auto v: get_vertexes(graph)) {
+            if (scc.id(v) == c)
+                cout << " " << v;
+        }
+        cout << endl;
+    }
+
+    auto dag = scc.condensation();
+    cout << "condensation:";
+    for (auto c: get_vertexes(*dag)) {
+        for (auto d: dag->get_adj_list(c))
+            cout << " " << c << "->" << d;
+    }
+    cout << endl;
+}
+
+int main(int argc, char *argv[])
+{
+    int vertex_number = 8;
+    vector<tuple<int, int>> edges = {
+        {0,1}, {1,2}, {2,0},            // 分量{0,1,2}
+        {2,3}, {3,4}, {4,3},            // 分量{3,4}
+        {1,5}, {5,6}, {6,7}, {7,5},     // 分量{5,6,7}
+        {4,7},
+    };
+
+    auto graph = make_digraph<sparse_multi_graph>(vertex_number, edges);
+    print_scc(*graph);
+
+    auto dense = make_digraph<dense_graph>(vertex_number, edges);
+    print_scc(*dense);
+
+    // 1000000个顶点的环, 递归版本会导致栈溢出
+    vertex_number = 1000000;
+    edges.clear();
+    for (int v = 0; v < vertex_number; v++)
+        edges.push_back({v, (v+1) % vertex_number});
+    auto ring = make_digraph<csr_graph>(vertex_number, edges);
+
+    SCC<csr_graph> scc(*ring);
+    scc.calculate();
+    cout << "ring of " << vertex_number << " vertexes: " << scc.count()
+        << " strongly connected component" << endl;
+
+    return 0;
+}
@@ -0,0 +1,4 @@
+#!/usr/bin/env bash
+
+echo "./sample_unweight_digraph_scc1"
+./sample_unweight_digraph_scc1
@@ -0,0 +1,76 @@
+/** \example sample_unweight_digraph_parallel_scc1.cpp
+ * This is an example of how to use the unweight::ParallelSCC class.
+ */
+
+#include <vector>
+#include <random>
+#include <iostream>
+#include "unweight_sparse_multi_graph.hpp"
+#include "unweight_csr_graph.hpp"
+#include "unweight_graph_utils.hpp"
+#include "unweight_digraph_scc.hpp"
+#include "unweight_digraph_parallel_scc.hpp"
+
+using namespace std;
+using namespace unweight;
+
+int main(int argc, char *argv[])
+{
+    int vertex_number = 10;
+    vector<tuple<int, int>> edges = {
+        {0,1}, {1,2}, {2,0},            // 分量{0,1,2}
+        {2,3}, {3,4}, {4,3},            // 分量{3,4}
+        {1,5}, {5,6}, {6,7}, {7,5},     // 分量{5,6,7}
+        {4,7}, {8,0}, {7,9},            // 8和9被剪枝
+    };
+
+    auto graph = make_digraph<sparse_multi_graph>(vertex_number, edges);
+    ParallelSCC<sparse_multi_graph> scc(*graph, 4);
+    scc.calculate();
+
+    cout << scc.count() << " strongly connected components" << endl;
+    for (int c = 0; c < scc.count(); c++) {
+        cout << "  " << c << ":";
+        for (auto v: get_vertexes(*graph)) {
+            if (scc.id(v) == c)
+                cout << " " << v;
+        }
+        cout << endl;
+    }
+    cout << "trimmed: " << scc.trimmed_count()
+        << ", pivot component: " << scc.pivot_component_size()
+        << ", color rounds: " << scc.color_rounds() << endl;
+
+    // 随机有向图, 与Tarjan算法的结果比较
+    vertex_number = 100000;
+    edges.clear();
+    mt19937 gen(2020);
+    uniform_int_distribution<int> dist(0, vertex_number-1);
+    for (int i = 0; i < 2 * vertex_number; i++) {
+        int v = dist(gen);
+        int w = dist(gen);
+        edges.push_back({v, w});
+    }
+    auto random_graph = make_digraph<csr_graph>(vertex_number, edges);
+
+    ParallelSCC<csr_graph> pscc(*random_graph, scc.pool());
+    pscc.calculate();
+    SCC<csr_graph> tarjan(*random_graph);
+    tarjan.calculate();
+
+    // 两种编号之间应该是一一对应的
+    bool same = pscc.count() == tarjan.count();
+    vector<int> to_tarjan(pscc.count(), -1);
+    for (int v = 0; same && v < vertex_number; v++) {
+        int &c = to_tarjan[pscc.id(v)];
+        if (c == -1)
+            c = tarjan.id(v);
+        same = c == tarjan.id(v);
+    }
+    cout << "random graph: " << pscc.count() << " strongly connected components, "
+        << "trimmed: " << pscc.trimmed_count()
+        << ", pivot component: " << pscc.pivot_component_size() << endl;
+    cout << "same as Tarjan: " << (same ? "yes" : "no") << endl;
+
+    return 0;
+}
@@ -0,0 +1,131 @@
+/** \example sample_weight_graph_dijkstra1.cpp
+ * This is an example of how to use the weight::Dijkstra class.
+ */
+
+#include <string>
+#include <vector>
+#include <random>
+#include <iostream>
+#include "weight_sparse_multi_graph.hpp"
+#include "weight_dense_graph.hpp"
+#include "weight_graph_dijkstra.hpp"
+
+using namespace std;
+using namespace weight;
+
+using Edge = sparse_multi_graph::edge_type;
+using Graph = sparse_multi_graph;
+
+template <typename Graph, typename Heap>
+void print_paths(const Graph &graph, const vector<string> &vmap)
+{
+    Dijkstra<Graph, Heap> dijkstra(graph);
+    dijkstra.search(0);
+
+    for (int v = 0; v < graph.vertex_count(); v++) {
+        cout << "  " << vmap[v] << ": " << dijkstra.distance(v) << ",";
+        for (auto w: dijkstra.path_to(v))
+            cout << " " << vmap[w];
+        cout << endl;
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    //                      0    1    2    3    4
+    vector<string> vmap = {"s", "t", "x", "y", "z"};
+    vector<Edge> edges = {
+        {0,1, 10}, {0,3, 5},
+        {1,2, 1}, {1,3, 2},
+        {2,4, 4},
+        {3,1, 3}, {3,2, 9}, {3,4, 2},
+        {4,0, 7}, {4,2, 6},
+    };
+    int vertex_number = vmap.size();
+
+    auto graph = Graph::make_digraph(vertex_number);
+    for (auto &edge: edges)
+        graph->insert(&edge);
+
+    cout << "binary heap:" << endl;
+    print_paths<Graph, binary_heap>(*graph, vmap);
+
+    cout << "4-ary heap with decrease-key:" << endl;
+    print_paths<Graph, dary_heap<4>>(*graph, vmap);
+
+    cout << "radix heap:" << endl;
+    print_paths<Graph, radix_heap>(*graph, vmap);
+
+    // 非整数权重不能用于基数堆, Dijkstra<Graph, radix_heap>改用二叉堆
+    vector<Edge> half_edges;
+    for (auto &edge: edges)
+        half_edges.emplace_back(edge.from(), edge.to(), edge.weight() / 2);
+    auto half = Graph::make_digraph(vertex_number);
+    for (auto &edge: half_edges)
+        half->insert(&edge);
+    Dijkstra<Graph, radix_heap> half_radix(*half);
+    half_radix.search(0);
+    cout << "radix heap on halved weights: s -> z = " << half_radix.distance(4)
+        << (half_radix.uses_fallback_heap() ? " (binary heap fallback)" : "") << endl;
+
+    vector<dense_graph::edge_type> dense_edges;
+    for (auto &edge: edges)
+        dense_edges.emplace_back(edge.from(), edge.to(), edge.weight());
+    auto dense = dense_graph::make_digraph(vertex_number);
+    for (auto &edge: dense_edges)
+        dense->insert(&edge);
+
+    cout << "dense graph:" << endl;
+    print_paths<dense_graph, binary_heap>(*dense, vmap);
+
+    // 200x200的网格, 重复使用同一个工作区进行点对点查询
+    int width = 200;
+    vertex_number = width * width;
+    mt19937 gen(2020);
+    uniform_int_distribution<int> weight_dist(1, 100);
+    uniform_int_distribution<int> vertex_dist(0, vertex_number-1);
+    vector<Edge> grid_edges;
+    for (int y = 0; y < width; y++) {
+        for (int x = 0; x < width; x++) {
+            int v = y * width + x;
+            if (x + 1 < width) grid_edges.emplace_back(v, v+1, weight_dist(gen));
+            if (y + 1 < width) grid_edges.emplace_back(v, v+width, weight_dist(gen));
+        }
+    }
+    auto grid = Graph::make_graph(vertex_number);
+    for (auto &edge: grid_edges)
+        grid->insert(&edge);
+
+    shortest_path_workspace ws;
+    Dijkstra<Graph, dary_heap<4>> dary(*grid, ws);
+    Dijkstra<Graph, radix_heap> radix(*grid);
+    for (int i = 0; i < 5; i++) {
+        int s = vertex_dist(gen);
+        int t = vertex_dist(gen);
+        double d = dary.search(s, t);
+        int settled = dary.settled_count();
+        cout << "grid " << s << " -> " << t << ": " << d
+            << " (" << dary.path_to(t).size() << " vertexes on path, "
+            << settled << " settled), radix heap: " << radix.search(s, t) << endl;
+    }
+
+    // 两个Dijkstra对象共享工作区时, 后一次查询使前一个对象的结果失效
+    shortest_path_workspace shared_ws;
+    Dijkstra<Graph> dijkstra_a(*graph, shared_ws);
+    Dijkstra<Graph> dijkstra_b(*graph, shared_ws);
+    dijkstra_a.search(0);
+    cout << "a.search(0): a.distance(4) = " << dijkstra_a.distance(4) << endl;
+    dijkstra_b.search(4);
+    cout << "b.search(4): a.distance(4) = " << dijkstra_a.distance(4)
+        << ", a.has_path_to(4) = " << dijkstra_a.has_path_to(4)
+        << ", a.path_to(4).size() = " << dijkstra_a.path_to(4).size()
+        << ", b.distance(1) = " << dijkstra_b.distance(1) << endl;
+    if (dijkstra_a.distance(4) != shortest_path_workspace::infinity || dijkstra_a.has_path_to(4)
+            || !dijkstra_a.path_to(4).empty() || dijkstra_a.parent(4) != -1
+            || dijkstra_b.distance(1) != 15) {
+        cout << "shared workspace check failed!" << endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,91 @@
+/** \example sample_weight_graph_delta_stepping1.cpp
+ * This is an example of how to use the weight::DeltaStepping class.
+ */
+
+#include <string>
+#include <vector>
+#include <random>
+#include <iostream>
+#include "weight_sparse_multi_graph.hpp"
+#include "weight_graph_dijkstra.hpp"
+#include "weight_graph_delta_stepping.hpp"
+
+using namespace std;
+using namespace weight;
+
+using Edge = sparse_multi_graph::edge_type;
+using Graph = sparse_multi_graph;
+
+int main(int argc, char *argv[])
+{
+    //                      0    1    2    3    4
+    vector<string> vmap = {"s", "t", "x", "y", "z"};
+    vector<Edge> edges = {
+        {0,1, 10}, {0,3, 5},
+        {1,2, 1}, {1,3, 2},
+        {2,4, 4},
+        {3,1, 3}, {3,2, 9}, {3,4, 2},
+        {4,0, 7}, {4,2, 6},
+    };
+    int vertex_number = vmap.size();
+
+    auto graph = Graph::make_digraph(vertex_number);
+    for (auto &edge: edges)
+        graph->insert(&edge);
+
+    DeltaStepping<Graph> delta_stepping(*graph, 4);
+    delta_stepping.set_delta(3);
+    delta_stepping.search(0);
+    cout << "delta = " << delta_stepping.delta() << ", "
+        << delta_stepping.bucket_count() << " buckets" << endl;
+    for (int v = 0; v < vertex_number; v++)
+        cout << "  " << vmap[v] << ": " << delta_stepping.distance(v) << endl;
+
+    // 300x300的网格, 自动选择delta, 与Dijkstra算法的结果比较
+    int width = 300;
+    vertex_number = width * width;
+    mt19937 gen(2020);
+    uniform_real_distribution<double> weight_dist(1, 100);
+    vector<Edge> grid_edges;
+    for (int y = 0; y < width; y++) {
+        for (int x = 0; x < width; x++) {
+            int v = y * width + x;
+            if (x + 1 < width) grid_edges.emplace_back(v, v+1, weight_dist(gen));
+            if (y + 1 < width) grid_edges.emplace_back(v, v+width, weight_dist(gen));
+        }
+    }
+    auto grid = Graph::make_graph(vertex_number);
+    for (auto &edge: grid_edges)
+        grid->insert(&edge);
+
+    DeltaStepping<Graph> grid_delta_stepping(*grid, delta_stepping.pool());
+    grid_delta_stepping.search(0);
+    Dijkstra<Graph> dijkstra(*grid);
+    dijkstra.search(0);
+
+    bool same = true;
+    for (int v = 0; v < vertex_number; v++)
+        same = same && grid_delta_stepping.distance(v) == dijkstra.distance(v);
+    cout << "grid: delta = " << grid_delta_stepping.delta() << ", "
+        << grid_delta_stepping.bucket_count() << " buckets, "
+        << "distance to the far corner: " << grid_delta_stepping.distance(vertex_number-1) << endl;
+    cout << "same as Dijkstra: " << (same ? "yes" : "no") << endl;
+
+    // 加入一条权重极大的边, 自动选择的delta基于平均权重, 基本不受影响;
+    // delta很小时桶的个数很多, 但每个线程只保存一个循环数组
+    Edge outlier(5, vertex_number-7, 1e6);
+    grid->insert(&outlier);
+    dijkstra.search(0);
+    for (double delta: {0.0, 0.01}) {
+        grid_delta_stepping.set_delta(delta);
+        grid_delta_stepping.search(0);
+        same = true;
+        for (int v = 0; v < vertex_number; v++)
+            same = same && grid_delta_stepping.distance(v) == dijkstra.distance(v);
+        cout << "grid with an outlier edge: delta = " << grid_delta_stepping.delta() << ", "
+            << grid_delta_stepping.bucket_count() << " buckets, same as Dijkstra: "
+            << (same ? "yes" : "no") << endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,4 @@
+#!/usr/bin/env bash
+
+echo "./sample_weight_graph_delta_stepping1"
+./sample_weight_graph_delta_stepping1
@@ -0,0 +1,107 @@
+/** \example sample_weight_graph_alt1.cpp
+ * This is an example of how to use the weight::AStar and weight::ALT classes.
+ */
+
+#include <cstdlib>
+#include <vector>
+#include <random>
+#include <sstream>
+#include <iostream>
+#include "weight_sparse_multi_graph.hpp"
+#include "weight_graph_dijkstra.hpp"
+#include "weight_graph_astar.hpp"
+#include "weight_graph_alt.hpp"
+
+using namespace std;
+using namespace weight;
+
+using Edge = sparse_multi_graph::edge_type;
+using Graph = sparse_multi_graph;
+
+int main(int argc, char *argv[])
+{
+    // 200x200的网格, 每条边的权重在[1, 100]之间
+    int width = 200;
+    int vertex_number = width * width;
+    mt19937 gen(2020);
+    uniform_int_distribution<int> weight_dist(1, 100);
+    uniform_int_distribution<int> vertex_dist(0, vertex_number-1);
+    vector<Edge> edges;
+    for (int y = 0; y < width; y++) {
+        for (int x = 0; x < width; x++) {
+            int v = y * width + x;
+            if (x + 1 < width) edges.emplace_back(v, v+1, weight_dist(gen));
+            if (y + 1 < width) edges.emplace_back(v, v+width, weight_dist(gen));
+        }
+    }
+    auto graph = Graph::make_graph(vertex_number);
+    for (auto &edge: edges)
+        graph->insert(&edge);
+
+    // 预处理: 选择8个路标, 保存距离表, 再读入
+    landmark_table table;
+    table.build(*graph, 8);
+    table.save("landmarks.alt");
+
+    landmark_table loaded;
+    if (!loaded.load("landmarks.alt"))
+        return 1;
+    cout << loaded.landmark_count() << " landmarks:";
+    for (auto v: loaded.landmarks())
+        cout << " " << v;
+    cout << endl;
+
+    // 头部声称有2e9个顶点和路标, 但是没有数据: 读入失败, 距离表不变
+    stringstream corrupt;
+    int32_t header[4] = {2000000000, 2000000000, 0, 0};
+    uint64_t checksum = 0;
+    corrupt.write("ALT2", 4);
+    corrupt.write(reinterpret_cast<const char *>(header), sizeof(header));
+    corrupt.write(reinterpret_cast<const char *>(&checksum), sizeof(checksum));
+    bool corrupt_loaded = loaded.load(corrupt);
+    cout << "malformed header: load " << (corrupt_loaded ? "succeeded" : "failed")
+        << ", " << loaded.landmark_count() << " landmarks kept" << endl;
+    if (corrupt_loaded || loaded.landmark_count() != 8)
+        return 1;
+
+    shortest_path_workspace ws;
+    Dijkstra<Graph> dijkstra(*graph, ws);
+    AStar<Graph> astar(*graph, ws);
+    ALT<Graph> alt(*graph, loaded, ws);
+
+    for (int i = 0; i < 5; i++) {
+        int s = vertex_dist(gen);
+        int t = vertex_dist(gen);
+
+        double d = dijkstra.search(s, t);
+        int dijkstra_settled = dijkstra.settled_count();
+
+        // 每条边的权重至少为1, 网格上的曼哈顿距离是一个一致的下界
+        int tx = t % width, ty = t / width;
+        double a = astar.search(s, t, [=](int v) {
+            return (double) (abs(v % width - tx) + abs(v / width - ty));
+        });
+        int astar_settled = astar.settled_count();
+
+        double l = alt.search(s, t);
+        cout << s << " -> " << t << ": " << d << " / " << a << " / " << l
+            << ", settled: Dijkstra " << dijkstra_settled
+            << ", A* " << astar_settled
+            << ", ALT " << alt.settled_count()
+            << ", path has " << alt.path_to(t).size() << " vertexes" << endl;
+    }
+
+    // 插入一条捷径之后, 原来的距离表不再是这个图的下界, 同一个ALT对象发现之后不再使用它
+    Edge shortcut(0, vertex_number-1, 1);
+    graph->insert(&shortcut);
+    double d = dijkstra.search(0, vertex_number-1);
+    double l = alt.search(0, vertex_number-1);
+    cout << "after inserting a shortcut: table matches = " << (alt.table_matches() ? "yes" : "no")
+        << ", 0 -> " << vertex_number-1 << ": " << d << " / " << l << endl;
+    if (alt.table_matches() || d != l) {
+        cout << "landmark table check failed!" << endl;
+        return 1;
+    }
+
+    return 0;
+}
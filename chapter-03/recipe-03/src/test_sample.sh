@@ -0,0 +1,4 @@
+#!/usr/bin/env bash
+
+echo "./sample_weight_graph_alt1"
+./sample_weight_graph_alt1
@@ -0,0 +1,84 @@
+/** \example sample_weight_graph_contraction_hierarchy1.cpp
+ * This is an example of how to use the weight::contraction_hierarchy and weight::CH classes.
+ */
+
+#include <string>
+#include <vector>
+#include <random>
+#include <iostream>
+#include "weight_sparse_multi_graph.hpp"
+#include "weight_graph_dijkstra.hpp"
+#include "weight_graph_contraction_hierarchy.hpp"
+
+using namespace std;
+using namespace weight;
+
+using Edge = sparse_multi_graph::edge_type;
+using Graph = sparse_multi_graph;
+
+int main(int argc, char *argv[])
+{
+    // 60x60的网格, 每条边的权重在[1, 100]之间
+    int width = 60;
+    int vertex_number = width * width;
+    mt19937 gen(2020);
+    uniform_int_distribution<int> weight_dist(1, 100);
+    uniform_int_distribution<int> vertex_dist(0, vertex_number-1);
+    vector<Edge> edges;
+    for (int y = 0; y < width; y++) {
+        for (int x = 0; x < width; x++) {
+            int v = y * width + x;
+            if (x + 1 < width) edges.emplace_back(v, v+1, weight_dist(gen));
+            if (y + 1 < width) edges.emplace_back(v, v+width, weight_dist(gen));
+        }
+    }
+    auto graph = Graph::make_graph(vertex_number);
+    for (auto &edge: edges)
+        graph->insert(&edge);
+
+    // 预处理: 4个线程
+    contraction_hierarchy ch;
+    ch.build(*graph, 4);
+    cout << graph->edge_count() << " edges, " << ch.shortcut_count() << " shortcuts, "
+        << ch.arc_count() << " upward arcs, " << ch.round_count() << " rounds" << endl;
+
+    Dijkstra<Graph> dijkstra(*graph);
+    CH<> query(ch);
+    for (int i = 0; i < 5; i++) {
+        int s = vertex_dist(gen);
+        int t = vertex_dist(gen);
+
+        double d = dijkstra.search(s, t);
+        double c = query.search(s, t);
+        auto path = query.path_to(t);
+        cout << s << " -> " << t << ": " << d << " / " << c
+            << ", settled: Dijkstra " << dijkstra.settled_count()
+            << ", CH " << query.settled_count()
+            << ", path has " << path.size() << " vertexes"
+            << (path == dijkstra.path_to(t) ? "" : " (another shortest path)") << endl;
+    }
+
+    // 有向图
+    //                      0    1    2    3    4
+    vector<string> vmap = {"s", "t", "x", "y", "z"};
+    vector<Edge> digraph_edges = {
+        {0,1, 10}, {0,3, 5},
+        {1,2, 1}, {1,3, 2},
+        {2,4, 4},
+        {3,1, 3}, {3,2, 9}, {3,4, 2},
+        {4,0, 7}, {4,2, 6},
+    };
+    auto digraph = Graph::make_digraph(vmap.size());
+    for (auto &edge: digraph_edges)
+        digraph->insert(&edge);
+
+    contraction_hierarchy dich;
+    dich.build(*digraph, 1);
+    CH<> diquery(dich);
+    cout << "s -> x: " << diquery.search(0, 2) << ", path:";
+    for (auto v: diquery.path_to(2))
+        cout << " " << vmap[v];
+    cout << endl;
+
+    return 0;
+}
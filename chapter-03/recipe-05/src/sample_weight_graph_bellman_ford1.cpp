@@ -0,0 +1,92 @@
+/** \example sample_weight_graph_bellman_ford1.cpp
+ * This is an example of how to use the weight::BellmanFord and weight::SPFA classes.
+ */
+
+#include <cmath>
+#include <tuple>
+#include <string>
+#include <vector>
+#include <iostream>
+#include "weight_sparse_multi_graph.hpp"
+#include "weight_graph_bellman_ford.hpp"
+
+using namespace std;
+using namespace weight;
+
+using Edge = sparse_multi_graph::edge_type;
+using Graph = sparse_multi_graph;
+
+int main(int argc, char *argv[])
+{
+    // 有负权重的边, 但没有负环
+    //                      0    1    2    3    4
+    vector<string> vmap = {"s", "t", "x", "y", "z"};
+    vector<Edge> edges = {
+        {0,1, 6}, {0,3, 7},
+        {1,2, 5}, {1,3, 8}, {1,4, -4},
+        {2,1, -2},
+        {3,2, -3}, {3,4, 9},
+        {4,0, 2}, {4,2, 7},
+    };
+    int vertex_number = vmap.size();
+
+    auto graph = Graph::make_digraph(vertex_number);
+    for (auto &edge: edges)
+        graph->insert(&edge);
+
+    BellmanFord<Graph> bellman_ford(*graph, 2);
+    bellman_ford.search(0);
+    SPFA<Graph> spfa(*graph);
+    spfa.search(0);
+    cout << "Bellman-Ford: " << bellman_ford.round_count() << " rounds, "
+        << "SPFA: " << spfa.relax_count() << " relaxations" << endl;
+    for (int v = 0; v < vertex_number; v++) {
+        cout << "  " << vmap[v] << ": " << bellman_ford.distance(v) << " / " << spfa.distance(v)
+            << ", path:";
+        for (auto w: bellman_ford.path_to(v))
+            cout << " " << vmap[w];
+        cout << endl;
+    }
+
+    // 套汇: 边的权重为-log(汇率), 负环就是汇率的乘积大于1的兑换序列
+    vector<string> currencies = {"USD", "EUR", "GBP", "JPY", "CNY"};
+    vector<tuple<int, int, double>> rates = {
+        {0,1, 0.85}, {1,0, 1.17},
+        {0,2, 0.77}, {2,0, 1.29},
+        {0,3, 105.0}, {3,0, 0.0095},
+        {0,4, 6.70}, {4,0, 0.149},
+        {1,2, 0.91}, {2,1, 1.09},
+        {1,4, 7.95}, {4,2, 0.118},
+    };
+    vector<Edge> rate_edges;
+    for (auto [from, to, rate]: rates)
+        rate_edges.emplace_back(from, to, -log(rate));
+    auto market = Graph::make_digraph(currencies.size());
+    for (auto &edge: rate_edges)
+        market->insert(&edge);
+
+    BellmanFord<Graph> market_bellman_ford(*market, bellman_ford.pool());
+    market_bellman_ford.search(0);
+    SPFA<Graph> market_spfa(*market);
+    market_spfa.search(0);
+    for (auto *cycle: {&market_bellman_ford.negative_cycle(), &market_spfa.negative_cycle()}) {
+        if (cycle->empty()) {
+            cout << "no arbitrage" << endl;
+            continue;
+        }
+        double product = 1;
+        cout << "arbitrage:";
+        for (size_t i = 0; i < cycle->size(); i++) {
+            int from = (*cycle)[i];
+            int to = (*cycle)[(i + 1) % cycle->size()];
+            for (auto [u, v, rate]: rates) {
+                if (u == from && v == to)
+                    product *= rate;
+            }
+            cout << " " << currencies[from] << " ->";
+        }
+        cout << " " << currencies[cycle->front()] << ", product of rates = " << product << endl;
+    }
+
+    return 0;
+}
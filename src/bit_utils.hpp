@@ -0,0 +1,112 @@
+/**
+ * @file bit_utils.hpp
+ * @brief 位图(bitmap)使用的位运算工具函数
+ * @author hexu_1985@sina.com
+ * @version 1.0
+ * @date 2020-09-14
+ */
+#ifndef BIT_UTILS_INC
+#define BIT_UTILS_INC
+
+#include <cstdint>
+
+#if defined(__AVX2__) || defined(__SSE4_1__)
+#include <immintrin.h>
+#endif
+
+namespace bits {
+
+/**
+ * @brief 每个字的位数
+ */
+constexpr int word_bits = 64;
+
+/**
+ * @brief 容纳n个位需要的字数
+ *
+ * @param n 位数
+ *
+ * @return 字数
+ */
+inline int word_count(int n)
+{
+    return (n + word_bits - 1) / word_bits;
+}
+
+/**
+ * @brief 返回最低位的1所在的位置(count trailing zeros)
+ *
+ * @param x 非0的字
+ *
+ * @return 最低位的1的位置, 范围为[0, 64)
+ */
+inline int count_trailing_zeros(uint64_t x)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(x);
+#else
+    int n = 0;
+    while ((x & 1) == 0) {
+        x >>= 1;
+        n++;
+    }
+    return n;
+#endif
+}
+
+/**
+ * @brief 返回最高位的1之前的0的个数(count leading zeros)
+ *
+ * @param x 非0的字
+ *
+ * @return 最高位的1之前的0的个数, 范围为[0, 64)
+ */
+inline int count_leading_zeros(uint64_t x)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_clzll(x);
+#else
+    int n = 0;
+    while ((x & (uint64_t(1) << 63)) == 0) {
+        x <<= 1;
+        n++;
+    }
+    return n;
+#endif
+}
+
+/**
+ * @brief 在words[first, last)中查找第一个不为0的字, 支持AVX2/SSE4.1时一次检查多个字
+ *
+ * @param words 字数组
+ * @param first 查找的起始位置
+ * @param last 查找的结束位置
+ *
+ * @return 第一个不为0的字的位置, 如果没有, 返回last
+ */
+inline int find_nonzero_word(const uint64_t *words, int first, int last)
+{
+    int i = first;
+#if defined(__AVX2__)
+    for (; i + 4 <= last; i += 4) {
+        __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(words + i));
+        if (!_mm256_testz_si256(x, x))
+            break;
+    }
+#elif defined(__SSE4_1__)
+    for (; i + 2 <= last; i += 2) {
+        __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i *>(words + i));
+        if (!_mm_testz_si128(x, x))
+            break;
+    }
+#endif
+    for (; i < last; i++) {
+        if (words[i] != 0)
+            break;
+    }
+    return i;
+}
+
+}   // namespace bits
+
+#endif  // BIT_UTILS_INC
@@ -0,0 +1,211 @@
+/**
+ * @file parallel_utils.hpp
+ * @brief 并行算法使用的线程池和并行循环工具
+ * @author hexu_1985@sina.com
+ * @version 1.0
+ * @date 2020-09-12
+ */
+#ifndef PARALLEL_UTILS_INC
+#define PARALLEL_UTILS_INC
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace parallel {
+
+/**
+ * @brief 返回默认的线程个数(硬件支持的并发线程数)
+ *
+ * @return 线程个数, 至少为1
+ */
+inline int default_thread_count()
+{
+    int n = static_cast<int>(std::thread::hardware_concurrency());
+    return n > 0 ? n : 1;
+}
+
+/**
+ * @brief 一个fork-join式的线程池
+ *
+ * 线程池创建后工作线程一直存在, 每次调用run()时所有线程(包括调用者线程)
+ * 同时执行同一个任务, run()在所有线程都完成后才返回.
+ */
+class thread_pool {
+private:
+    std::vector<std::thread> workers_;
+    std::function<void(int)> task_;
+    std::mutex mutex_;
+    std::condition_variable start_cv_;
+    std::condition_variable done_cv_;
+    int generation_ = 0;        // 每次run()加1, 用于唤醒工作线程
+    int running_ = 0;           // 尚未完成当前任务的工作线程数
+    bool stop_ = false;
+
+    void worker_loop(int tid)
+    {
+        int seen = 0;
+        for (;;) {
+            std::unique_lock<std::mutex> lock(mutex_);
+            start_cv_.wait(lock, [&] { return stop_ || generation_ != seen; });
+            if (stop_) return;
+            seen = generation_;
+            lock.unlock();
+
+            task_(tid);
+
+            lock.lock();
+            if (--running_ == 0)
+                done_cv_.notify_one();
+        }
+    }
+
+public:
+    /**
+     * @brief 构造一个线程池
+     *
+     * @param thread_count 线程个数(包括调用者线程), 小于1时使用default_thread_count()
+     */
+    explicit thread_pool(int thread_count = 0)
+    {
+        if (thread_count < 1)
+            thread_count = default_thread_count();
+        for (int tid = 1; tid < thread_count; tid++)
+            workers_.emplace_back(&thread_pool::worker_loop, this, tid);
+    }
+
+    ~thread_pool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        start_cv_.notify_all();
+        for (auto &t: workers_)
+            t.join();
+    }
+
+    thread_pool(const thread_pool &) = delete;
+    thread_pool &operator =(const thread_pool &) = delete;
+
+    /**
+     * @brief 返回线程个数
+     *
+     * @return 线程个数(包括调用者线程)
+     */
+    int size() const { return static_cast<int>(workers_.size()) + 1; }
+
+    /**
+     * @brief 所有线程同时执行f(tid), tid为[0, size())之间的线程编号
+     *
+     * @param f 任务
+     */
+    template <typename Func>
+    void run(Func f)
+    {
+        if (workers_.empty()) {
+            f(0);
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            task_ = f;
+            running_ = static_cast<int>(workers_.size());
+            generation_++;
+        }
+        start_cv_.notify_all();
+
+        f(0);
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        done_cv_.wait(lock, [&] { return running_ == 0; });
+    }
+};
+
+/**
+ * @brief 把[first, last)平均分成块, 第tid个线程处理第tid块
+ *
+ * @param first 区间起点
+ * @param last 区间终点
+ * @param tid 线程编号
+ * @param thread_count 线程个数
+ *
+ * @return 第tid块的起点和终点
+ */
+inline std::pair<int, int> split_range(int first, int last, int tid, int thread_count)
+{
+    long long n = last - first;
+    int begin = first + static_cast<int>(n * tid / thread_count);
+    int end = first + static_cast<int>(n * (tid+1) / thread_count);
+    return std::make_pair(begin, end);
+}
+
+/**
+ * @brief 并行地对[first, last)中的每个i执行f(tid, i)
+ *
+ * @param pool 线程池
+ * @param first 区间起点
+ * @param last 区间终点
+ * @param f 循环体, 参数为线程编号和循环变量
+ */
+template <typename Func>
+void parallel_for(thread_pool &pool, int first, int last, Func f)
+{
+    int thread_count = pool.size();
+    pool.run([&](int tid) {
+        auto [begin, end] = split_range(first, last, tid, thread_count);
+        for (int i = begin; i < end; i++)
+            f(tid, i);
+    });
+}
+
+/**
+ * @brief 并行地对[first, last)中的每个i执行f(tid, i), 各线程每次领取chunk个循环变量
+ *
+ * 与parallel_for()的静态划分不同, 先完成的线程继续领取剩下的块,
+ * 适合每次循环的代价相差很大的情况(例如顶点的度数不均匀).
+ *
+ * @param pool 线程池
+ * @param first 区间起点
+ * @param last 区间终点
+ * @param chunk 每次领取的循环变量个数, 至少为1
+ * @param f 循环体, 参数为线程编号和循环变量
+ */
+template <typename Func>
+void parallel_for_chunked(thread_pool &pool, int first, int last, int chunk, Func f)
+{
+    std::atomic<int> cursor(first);
+    pool.run([&](int tid) {
+        for (;;) {
+            int begin = cursor.fetch_add(chunk, std::memory_order_relaxed);
+            if (begin >= last) break;
+            int end = std::min(begin + chunk, last);
+            for (int i = begin; i < end; i++)
+                f(tid, i);
+        }
+    });
+}
+
+/**
+ * @brief 并行地对vec中的每个元素v执行f(v, tid), 各线程每次领取chunk个元素
+ *
+ * @param pool 线程池
+ * @param vec 元素列表, 循环过程中不能修改
+ * @param chunk 每次领取的元素个数, 至少为1
+ * @param f 循环体, 参数为元素和线程编号
+ */
+template <typename T, typename Func>
+void for_each_chunked(thread_pool &pool, const std::vector<T> &vec, int chunk, Func f)
+{
+    parallel_for_chunked(pool, 0, static_cast<int>(vec.size()), chunk,
+            [&](int tid, int i) { f(vec[i], tid); });
+}
+
+}   // namespace parallel
+
+#endif  // PARALLEL_UTILS_INC
@@ -0,0 +1,292 @@
+/**
+ * @file unweight_csr_graph.hpp
+ * @brief 一个只读的稀疏图实现, 基于压缩稀疏行(Compressed Sparse Row, CSR)格式(支持平行边)
+ * @author hexu_1985@sina.com
+ * @version 1.0
+ * @date 2020-09-10
+ */
+#ifndef UNWEIGHT_CSR_GRAPH_INC
+#define UNWEIGHT_CSR_GRAPH_INC
+
+#include <tuple>
+#include <memory>
+#include <vector>
+#include <atomic>
+#include <algorithm>
+#include "parallel_utils.hpp"
+
+namespace unweight {
+
+/**
+ * @brief 一个只读的稀疏图实现, 基于压缩稀疏行(CSR)格式(支持平行边)
+ *
+ * 所有顶点的邻接顶点连续存放在同一个数组中, 顶点v的邻接顶点位于
+ * neighbors_[offsets_[v], offsets_[v+1]), 遍历邻接列表时不会有指针跳转.
+ * 图创建之后不能再插入或删除边.
+ */
+class csr_graph {
+public:
+    /**
+     * @brief 边类型
+     */
+    using edge_type = std::tuple<int, int>;
+
+    /**
+     * @brief 创建一条边
+     *
+     * @param u 起点
+     * @param v 终点
+     *
+     * @return 边对象
+     */
+    static edge_type make_edge(int u, int v)
+    {
+        return std::make_tuple(u, v);
+    }
+
+private:
+    std::vector<int> offsets_;      // 每个顶点的邻接顶点在neighbors_中的起始位置, 共v_cnt_+1项
+    std::vector<int> neighbors_;    // 所有顶点的邻接顶点
+    int v_cnt_ = 0;                 // 顶点数
+    int e_cnt_ = 0;                 // 边数
+    bool directed_ = false;         // 是否为有向图
+
+    csr_graph() = default;
+
+public:
+    /**
+     * @brief 从其他类型的图构造一个CSR图对象, 邻接顶点的顺序与原图一致
+     *
+     * @tparam Graph 原图类型
+     * @param graph 原图
+     */
+    template <typename Graph>
+    explicit csr_graph(const Graph &graph) :
+        offsets_(graph.vertex_count()+1, 0), v_cnt_(graph.vertex_count()),
+        e_cnt_(graph.edge_count()), directed_(graph.is_directed())
+    {
+        // 第一遍统计每个顶点的度数, 得到每个顶点的起始位置
+        for (int v = 0; v < v_cnt_; v++) {
+            int degree = 0;
+            for (auto w: graph.get_adj_list(v)) {
+                (void) w;
+                degree++;
+            }
+            offsets_[v+1] = offsets_[v] + degree;
+        }
+
+        // 第二遍把邻接顶点依次填入
+        neighbors_.resize(offsets_[v_cnt_]);
+        for (int v = 0; v < v_cnt_; v++) {
+            int pos = offsets_[v];
+            for (auto w: graph.get_adj_list(v)) {
+                neighbors_[pos++] = w;
+            }
+        }
+    }
+
+    /**
+     * @brief 从边列表批量构造一个CSR图对象, 时间复杂度O(V+E)
+     *
+     * 先统计每个起点的度数, 再求前缀和得到每个顶点的起始位置, 最后把每条边
+     * 放到它的起点对应的位置(计数排序). 邻接数组只分配一次.
+     * 单线程时每个顶点的邻接顶点保持边列表中的顺序, 多线程时顺序不确定.
+     *
+     * @param v_cnt 图的顶点数
+     * @param edges 边列表
+     * @param directed 是否为有向图
+     * @param thread_count 线程个数
+     */
+    csr_graph(int v_cnt, const std::vector<edge_type> &edges, bool directed, int thread_count = 1) :
+        offsets_(v_cnt+1, 0), v_cnt_(v_cnt), e_cnt_(static_cast<int>(edges.size())), directed_(directed)
+    {
+        parallel::thread_pool pool(std::max(thread_count, 1));
+        int e_cnt = e_cnt_;
+        std::vector<std::atomic<int>> cursor(v_cnt);
+
+        // 统计每个顶点的度数
+        parallel::parallel_for(pool, 0, e_cnt, [&](int, int i) {
+            auto [u, v] = edges[i];
+            cursor[u].fetch_add(1, std::memory_order_relaxed);
+            if (!directed) cursor[v].fetch_add(1, std::memory_order_relaxed);
+        });
+
+        // 分块求前缀和: 每个线程先求自己块内的和, 再加上前面所有块的和
+        int thread_cnt = pool.size();
+        std::vector<int> block_sum(thread_cnt+1, 0);
+        pool.run([&](int tid) {
+            auto [begin, end] = parallel::split_range(0, v_cnt, tid, thread_cnt);
+            int sum = 0;
+            for (int v = begin; v < end; v++)
+                sum += cursor[v].load(std::memory_order_relaxed);
+            block_sum[tid+1] = sum;
+        });
+        for (int tid = 0; tid < thread_cnt; tid++)
+            block_sum[tid+1] += block_sum[tid];
+        pool.run([&](int tid) {
+            auto [begin, end] = parallel::split_range(0, v_cnt, tid, thread_cnt);
+            int sum = block_sum[tid];
+            for (int v = begin; v < end; v++) {
+                offsets_[v] = sum;
+                sum += cursor[v].load(std::memory_order_relaxed);
+                cursor[v].store(offsets_[v], std::memory_order_relaxed);
+            }
+        });
+        offsets_[v_cnt] = block_sum[thread_cnt];
+
+        // 把每条边放到起点对应的位置
+        neighbors_.resize(offsets_[v_cnt]);
+        parallel::parallel_for(pool, 0, e_cnt, [&](int, int i) {
+            auto [u, v] = edges[i];
+            neighbors_[cursor[u].fetch_add(1, std::memory_order_relaxed)] = v;
+            if (!directed) neighbors_[cursor[v].fetch_add(1, std::memory_order_relaxed)] = u;
+        });
+    }
+
+    /**
+     * @brief 返回图的顶点数
+     *
+     * @return 顶点个数
+     */
+    int vertex_count() const { return v_cnt_; }
+
+    /**
+     * @brief 返回图的边数
+     *
+     * @return 边的个数
+     */
+    int edge_count() const { return e_cnt_; }
+
+    /**
+     * @brief 是否为有向图
+     *
+     * @return 如果为有向图, 返回true, 否则为false
+     */
+    bool is_directed() const { return directed_; }
+
+    /**
+     * @brief 返回指定顶点的度数(有向图为出度)
+     *
+     * @param v 指定顶点
+     *
+     * @return 邻接顶点的个数
+     */
+    int degree(int v) const { return offsets_[v+1] - offsets_[v]; }
+
+    /**
+     * @brief 判断边是否属于指定图
+     *
+     * @param e 边
+     *
+     * @return 如果边属于指定图, 返回true, 否则返回false
+     */
+    bool has_edge(edge_type e) const
+    {
+        auto [u, v] = e;
+        auto first = neighbors_.data() + offsets_[u];
+        auto last = neighbors_.data() + offsets_[u+1];
+        return (std::find(first, last, v) != last);
+    }
+
+    /**
+     * @brief 指定顶点的所有邻接节点的列表
+     */
+    struct adj_list {
+        const int *first_;
+        const int *last_;
+
+        adj_list(const int *first, const int *last): first_(first), last_(last) {}
+
+        const int *begin() const { return first_; }
+
+        const int *end() const { return last_; }
+    };
+
+    /**
+     * @brief 获取指定顶点的邻接顶点的列表
+     *
+     * @param v 指定顶点
+     *
+     * @return 邻接顶点的迭代器
+     */
+    adj_list get_adj_list(int v) const
+    {
+        return adj_list(neighbors_.data() + offsets_[v], neighbors_.data() + offsets_[v+1]);
+    }
+
+    /**
+     * @brief 创建指定图的反向图(入边视图): 原图的每条边(u,v)对应反向图的边(v,u)
+     *
+     * 对有向图, 反向图中顶点v的邻接列表就是v的所有入边的起点;
+     * 对无向图, 反向图与原图的邻接关系相同.
+     *
+     * @tparam Graph 原图类型
+     * @param graph 原图
+     *
+     * @return 反向图
+     */
+    template <typename Graph>
+    static csr_graph make_reverse(const Graph &graph)
+    {
+        csr_graph rev;
+        int v_cnt = graph.vertex_count();
+        rev.v_cnt_ = v_cnt;
+        rev.e_cnt_ = graph.edge_count();
+        rev.directed_ = graph.is_directed();
+        rev.offsets_.assign(v_cnt+1, 0);
+
+        // 统计每个顶点的入度
+        for (int v = 0; v < v_cnt; v++) {
+            for (auto w: graph.get_adj_list(v)) {
+                rev.offsets_[w+1]++;
+            }
+        }
+        for (int v = 0; v < v_cnt; v++)
+            rev.offsets_[v+1] += rev.offsets_[v];
+
+        // 把每条边(v,w)作为w的入边放入
+        rev.neighbors_.resize(rev.offsets_[v_cnt]);
+        std::vector<int> cursor(rev.offsets_.begin(), rev.offsets_.end()-1);
+        for (int v = 0; v < v_cnt; v++) {
+            for (auto w: graph.get_adj_list(v)) {
+                rev.neighbors_[cursor[w]++] = v;
+            }
+        }
+
+        return rev;
+    }
+
+    /**
+     * @brief 从边列表批量创建有向图
+     *
+     * @param v_cnt 顶点个数
+     * @param edges 边列表
+     * @param thread_count 线程个数
+     *
+     * @return 有向图对象
+     */
+    static std::shared_ptr<csr_graph> make_digraph(int v_cnt, const std::vector<edge_type> &edges,
+            int thread_count = 1)
+    {
+        return std::make_shared<csr_graph>(v_cnt, edges, true, thread_count);
+    }
+
+    /**
+     * @brief 从边列表批量创建无向图
+     *
+     * @param v_cnt 顶点个数
+     * @param edges 边列表
+     * @param thread_count 线程个数
+     *
+     * @return 无向图对象
+     */
+    static std::shared_ptr<csr_graph> make_graph(int v_cnt, const std::vector<edge_type> &edges,
+            int thread_count = 1)
+    {
+        return std::make_shared<csr_graph>(v_cnt, edges, false, thread_count);
+    }
+};
+
+}   // namespace unweight
+
+#endif
@@ -13,11 +13,17 @@
 #include <tuple>
 #include <vector>
 #include <memory>
+#include <cstdint>
+#include <iterator>
+#include "bit_utils.hpp"
 
 namespace unweight {
 
 /**
  * @brief 一个稠密图实现, 基于邻接矩阵(不支持平行边)
+ *
+ * 邻接矩阵是一块连续的位矩阵, 每行按64位的字对齐, 遍历一行的邻接顶点只需要
+ * 扫描V/64个字.
  */
 class dense_graph { 
 public:
@@ -40,10 +46,11 @@ public:
     }
 
 private:
-    std::vector<std::vector<bool>> adj_mat_;  // 邻接矩阵
-    int v_cnt_ = 0;                           // 顶点数
-    int e_cnt_ = 0;                           // 边数
-    bool directed_ = false;                   // 是否为有向图
+    std::vector<uint64_t> adj_mat_;     // 邻接矩阵, 按行连续存放的位矩阵, 每行占row_words_个字
+    int row_words_ = 0;                 // 每行的字数
+    int v_cnt_ = 0;                     // 顶点数
+    int e_cnt_ = 0;                     // 边数
+    bool directed_ = false;             // 是否为有向图
 
     /**
      * @brief 初始化邻接矩阵
@@ -52,9 +59,40 @@ private:
      */
     void init_adj_mat()
     {
-        adj_mat_.resize(v_cnt_);
-        for (int i = 0; i < v_cnt_; i++) 
-            adj_mat_[i].assign(v_cnt_, false);
+        row_words_ = bits::word_count(v_cnt_);
+        adj_mat_.assign(static_cast<size_t>(row_words_) * v_cnt_, 0);
+    }
+
+    /**
+     * @brief 返回邻接矩阵第u行的起始地址
+     *
+     * @param u 行号
+     *
+     * @return 第u行的第一个字的地址
+     */
+    const uint64_t *row(int u) const
+    {
+        return adj_mat_.data() + static_cast<size_t>(row_words_) * u;
+    }
+
+    uint64_t *row(int u)
+    {
+        return adj_mat_.data() + static_cast<size_t>(row_words_) * u;
+    }
+
+    bool test(int u, int v) const
+    {
+        return (row(u)[v / bits::word_bits] >> (v % bits::word_bits)) & 1;
+    }
+
+    void set(int u, int v)
+    {
+        row(u)[v / bits::word_bits] |= uint64_t(1) << (v % bits::word_bits);
+    }
+
+    void reset(int u, int v)
+    {
+        row(u)[v / bits::word_bits] &= ~(uint64_t(1) << (v % bits::word_bits));
     }
 
 public:
@@ -99,9 +137,9 @@ public:
     void insert(edge_type e)
     { 
         auto [u, v] = e;
-        if (adj_mat_[u][v] == false) e_cnt_++;
-        adj_mat_[u][v] = true;
-        if (!directed_) adj_mat_[v][u] = true; 
+        if (!test(u, v)) e_cnt_++;
+        set(u, v);
+        if (!directed_) set(v, u);
     } 
 
     /**
@@ -112,9 +150,9 @@ public:
     void remove(edge_type e)
     { 
         auto [u, v] = e;
-        if (adj_mat_[u][v] == true) e_cnt_--;
-        adj_mat_[u][v] = false;
-        if (!directed_) adj_mat_[v][u] = false; 
+        if (test(u, v)) e_cnt_--;
+        reset(u, v);
+        if (!directed_) reset(v, u);
     } 
 
     /**
@@ -128,31 +166,43 @@ public:
     bool has_edge(edge_type e) const 
     { 
         auto [u, v] = e;
-        return adj_mat_[u][v]; 
+        return test(u, v);
     }
 
     /**
      * @brief 可以遍历指定顶点的所有邻接节点的迭代器
+     *
+     * 按字扫描邻接矩阵的一行: 跳过全0的字, 在非0的字中用count trailing zeros
+     * 直接定位下一个邻接顶点.
      */
     struct adj_iterator: public std::iterator<std::forward_iterator_tag, int> {
-        const std::vector<bool> *array_ = nullptr;
+        const uint64_t *row_ = nullptr;
+        int words_ = 0;         // 这一行的字数
+        int word_ = -1;         // 当前字的位置
+        uint64_t bits_ = 0;     // 当前字中还未访问的位
         int v_ = -1;
 
-        adj_iterator(const std::vector<bool> *array): array_(array)
+        adj_iterator(const uint64_t *row, int words): row_(row), words_(words)
         {
             next();
         }
 
-        adj_iterator(const std::vector<bool> *array, int v): array_(array), v_(v)
+        adj_iterator(const uint64_t *row, int words, int v): row_(row), words_(words), v_(v)
         {
         }
 
         void next()
         {
-            auto &array = *array_;
-            for (v_++ ; v_ < (int) array.size(); v_++)
-                if (array[v_])
-                    break;
+            while (bits_ == 0) {
+                word_ = bits::find_nonzero_word(row_, word_+1, words_);
+                if (word_ >= words_) {
+                    v_ = words_ * bits::word_bits;
+                    return;
+                }
+                bits_ = row_[word_];
+            }
+            v_ = word_ * bits::word_bits + bits::count_trailing_zeros(bits_);
+            bits_ &= bits_ - 1;     // 清除最低位的1
         }
 
         int operator *() const
@@ -175,7 +225,7 @@ public:
 
         bool operator ==(const adj_iterator &rhs) const
         {
-            return (this->array_ == rhs.array_ && this->v_ == rhs.v_);
+            return (this->row_ == rhs.row_ && this->v_ == rhs.v_);
         }
 
         bool operator !=(const adj_iterator &rhs) const
@@ -191,7 +241,8 @@ public:
         adj_iterator first_;
         adj_iterator last_;
 
-        adj_list(const std::vector<bool> &array): first_(&array), last_(&array, array.size()) {}
+        adj_list(const uint64_t *row, int words):
+            first_(row, words), last_(row, words, words * bits::word_bits) {}
 
         adj_iterator begin() const { return first_; }
 
@@ -207,7 +258,7 @@ public:
      */
     adj_list get_adj_list(int v) const 
     {
-        return adj_list(adj_mat_[v]); 
+        return adj_list(row(v), row_words_); 
     }
 
     /**
@@ -0,0 +1,258 @@
+/**
+ * @file unweight_digraph_dynamic_topo_sort.hpp
+ * @brief 插入边时增量维护的拓扑顺序(Pearce-Kelly算法)
+ * @author hexu_1985@sina.com
+ * @version 1.0
+ * @date 2020-10-04
+ *
+ * @see Pearce, Kelly: A dynamic topological sort algorithm for directed acyclic graphs (2006)
+ */
+#ifndef UNWEIGHT_DIGRAPH_DYNAMIC_TOPO_SORT_INC
+#define UNWEIGHT_DIGRAPH_DYNAMIC_TOPO_SORT_INC
+
+#include <vector>
+#include <algorithm>
+#include "unweight_traversal_workspace.hpp"
+
+namespace unweight {
+
+/**
+ * @brief 插入边时增量维护的拓扑顺序(Pearce-Kelly算法)
+ *
+ * 保存每个顶点的位置ord(v)和每个位置上的顶点, 查询的时间复杂度为O(1).
+ * 插入边(x,y)时, 如果ord(x) < ord(y), 顺序仍然有效; 否则只需要调整位置在[ord(y), ord(x)]
+ * 之间的顶点: 从y出发沿出边搜索位置不超过ord(x)的顶点(如果到达x, 说明会形成环),
+ * 从x出发沿入边搜索位置不小于ord(y)的顶点, 把这两部分顶点按原来的相对顺序
+ * 重新分配到它们原来占用的位置上, 前者排在后者之后.
+ *
+ * @tparam Graph 图类型, 需要提供insert(edge_type)
+ */
+template <typename Graph>
+class DynamicTopoSort {
+public:
+    using edge_type = typename Graph::edge_type;
+
+private:
+    Graph &graph_;
+    std::vector<std::vector<int>> in_adj_;  // 每个顶点的入边的起点
+    std::vector<int> ord_;                  // 每个顶点的位置
+    std::vector<int> order_;                // 每个位置上的顶点
+    bool acyclic_ = true;                   // 初始的图是否为有向无环图
+    traversal_workspace ws_;                // 搜索时的已探索标记和堆栈
+    std::vector<int> forward_;              // 从y出发可以到达的受影响顶点
+    std::vector<int> backward_;             // 可以到达x的受影响顶点
+    std::vector<int> slots_;                // 受影响顶点占用的位置
+
+public:
+    /**
+     * @brief 构造对象, 用Kahn算法计算初始的拓扑顺序
+     *
+     * @param graph 有向无环图, 之后应该通过insert()插入边; 如果有环, is_acyclic()返回false,
+     * insert()拒绝插入任何边
+     */
+    DynamicTopoSort(Graph &graph):
+        graph_(graph), in_adj_(graph.vertex_count()), ws_(graph.vertex_count())
+    {
+        int n = graph_.vertex_count();
+        std::vector<int> in_degree(n, 0);
+        for (int v = 0; v < n; v++) {
+            for (auto w: graph_.get_adj_list(v)) {
+                in_adj_[w].push_back(v);
+                in_degree[w]++;
+            }
+        }
+
+        // order_同时作为Kahn算法的队列
+        for (int v = 0; v < n; v++) {
+            if (in_degree[v] == 0)
+                order_.push_back(v);
+        }
+        for (int i = 0; i < (int) order_.size(); i++) {
+            for (auto w: graph_.get_adj_list(order_[i])) {
+                if (--in_degree[w] == 0)
+                    order_.push_back(w);
+            }
+        }
+
+        // 有环时, 环上的顶点和依赖于环的顶点排在最后
+        acyclic_ = (int) order_.size() == n;
+        for (int v = 0; v < n; v++) {
+            if (in_degree[v] > 0)
+                order_.push_back(v);
+        }
+
+        ord_.resize(n);
+        for (int i = 0; i < n; i++)
+            ord_[order_[i]] = i;
+    }
+
+    /**
+     * @brief 插入一条边并更新拓扑顺序
+     *
+     * @param e 要插入的边
+     *
+     * @return 如果插入后仍然无环, 插入这条边并返回true; 否则(包括构造时的图已经有环)不插入, 返回false
+     */
+    bool insert(edge_type e)
+    {
+        auto [x, y] = e;
+        forward_.clear();
+        backward_.clear();
+        if (!acyclic_ || x == y)
+            return false;
+
+        int lb = ord_[y];
+        int ub = ord_[x];
+        if (ub < lb) {
+            add_edge(e);
+            return true;
+        }
+
+        // 受影响的区域为位置在[ord(y), ord(x)]之间的顶点
+        ws_.reset(graph_.vertex_count());
+        if (!search_forward(y, x, ub)) {
+            forward_.clear();
+            return false;
+        }
+        search_backward(x, lb);
+
+        reorder();
+        add_edge(e);
+        return true;
+    }
+
+    /**
+     * @brief 顶点在拓扑顺序中的位置
+     *
+     * @param v 顶点
+     *
+     * @return 位置, 从0开始
+     */
+    int position(int v) const { return ord_[v]; }
+
+    /**
+     * @brief 拓扑顺序中指定位置上的顶点
+     *
+     * @param pos 位置
+     *
+     * @return 顶点
+     */
+    int vertex_at(int pos) const { return order_[pos]; }
+
+    /**
+     * @brief 当前的拓扑顺序
+     *
+     * @return 按拓扑顺序排列的顶点
+     */
+    const std::vector<int> &order() const { return order_; }
+
+    /**
+     * @brief 构造时的图是否为有向无环图
+     *
+     * @return 如果无环, 返回true; 否则返回false, 此时order()不是有效的拓扑顺序
+     */
+    bool is_acyclic() const { return acyclic_; }
+
+    /**
+     * @brief 最近一次insert()中被重新分配位置的顶点数
+     *
+     * @return 顶点数
+     */
+    int affected_count() const
+    {
+        return static_cast<int>(forward_.size() + backward_.size());
+    }
+
+    /**
+     * @brief 图
+     *
+     * @return 维护拓扑顺序的图
+     */
+    const Graph &graph() const { return graph_; }
+
+private:
+    void add_edge(edge_type e)
+    {
+        graph_.insert(e);
+        auto [x, y] = e;
+        in_adj_[y].push_back(x);
+    }
+
+    /**
+     * @brief 从y出发沿出边搜索位置不超过ub的顶点
+     *
+     * @return 如果到达x(会形成环), 返回false, 否则返回true
+     */
+    bool search_forward(int y, int x, int ub)
+    {
+        auto &S = ws_.stack();
+        ws_.visit(y);
+        S.push_back(y);
+        while (!S.empty()) {
+            int v = S.back(); S.pop_back();
+            forward_.push_back(v);
+            for (auto w: graph_.get_adj_list(v)) {
+                if (w == x)
+                    return false;
+                if (!ws_.is_visited(w) && ord_[w] < ub) {
+                    ws_.visit(w);
+                    S.push_back(w);
+                }
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief 从x出发沿入边搜索位置不小于lb的顶点
+     *
+     * 与search_forward()探索到的顶点不相交, 否则会形成环, 所以可以共用已探索标记.
+     */
+    void search_backward(int x, int lb)
+    {
+        auto &S = ws_.stack();
+        ws_.visit(x);
+        S.push_back(x);
+        while (!S.empty()) {
+            int v = S.back(); S.pop_back();
+            backward_.push_back(v);
+            for (auto u: in_adj_[v]) {
+                if (!ws_.is_visited(u) && ord_[u] > lb) {
+                    ws_.visit(u);
+                    S.push_back(u);
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief 把backward_和forward_中的顶点按原来的相对顺序依次放到它们占用的位置上
+     */
+    void reorder()
+    {
+        auto by_ord = [this](int a, int b) { return ord_[a] < ord_[b]; };
+        std::sort(forward_.begin(), forward_.end(), by_ord);
+        std::sort(backward_.begin(), backward_.end(), by_ord);
+
+        slots_.clear();
+        for (auto v: backward_)
+            slots_.push_back(ord_[v]);
+        for (auto v: forward_)
+            slots_.push_back(ord_[v]);
+        std::sort(slots_.begin(), slots_.end());
+
+        int i = 0;
+        for (auto v: backward_) {
+            ord_[v] = slots_[i];
+            order_[slots_[i++]] = v;
+        }
+        for (auto v: forward_) {
+            ord_[v] = slots_[i];
+            order_[slots_[i++]] = v;
+        }
+    }
+};
+
+}   // namespace unweight
+
+#endif
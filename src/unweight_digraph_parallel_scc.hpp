@@ -0,0 +1,369 @@
+/**
+ * @file unweight_digraph_parallel_scc.hpp
+ * @brief 多线程的有向图强连通分量算法(Multistep: 剪枝 + FW-BW + 着色)
+ * @author hexu_1985@sina.com
+ * @version 1.0
+ * @date 2020-10-08
+ *
+ * @see Slota, Rajamanickam, Madduri: BFS and coloring-based parallel algorithms for
+ *      strongly connected components and related problems (2014)
+ */
+#ifndef UNWEIGHT_DIGRAPH_PARALLEL_SCC_INC
+#define UNWEIGHT_DIGRAPH_PARALLEL_SCC_INC
+
+#include <vector>
+#include <memory>
+#include <atomic>
+#include <algorithm>
+#include "parallel_utils.hpp"
+#include "unweight_csr_graph.hpp"
+#include "unweight_graph_parallel_bfs.hpp"
+
+namespace unweight {
+
+/**
+ * @brief 多线程的有向图强连通分量算法(Multistep)
+ *
+ * 1. 剪枝(trim): 入度或出度为0的顶点不在任何环上, 各自组成一个强连通分量;
+ *    删除它们以后可能产生新的这样的顶点, 用原子计数器逐层并行地删除.
+ * 2. FW-BW: 选一个度数较大的顶点p, 用ParallelBFS沿出边求p可以到达的顶点集合FW,
+ *    再沿入边在FW中求可以到达p的顶点, 它们就是p所在的强连通分量, 通常是最大的一个.
+ * 3. 着色(coloring): 剩余的每个顶点v的颜色初始化为v, 沿出边并行地传播较大的颜色直到不再变化,
+ *    此时颜色为c的顶点都可以从c到达; 颜色等于自己的顶点r沿入边在颜色为r的顶点中搜索,
+ *    得到r所在的强连通分量. 不同颜色的搜索互不相交, 由多个线程同时进行. 重复直到所有顶点都有分量.
+ *
+ * 入边通过csr_graph::make_reverse()创建的反向视图访问, 适用于任何图类型.
+ *
+ * @tparam Graph 图类型
+ */
+template <typename Graph>
+class ParallelSCC {
+private:
+    const Graph &graph_;
+    std::unique_ptr<parallel::thread_pool> own_pool_;
+    parallel::thread_pool &pool_;
+    std::unique_ptr<csr_graph> in_graph_;           // 反向视图
+    std::vector<std::atomic<int>> rep_;             // 每个顶点所在分量的代表顶点, 未确定为-1
+    std::vector<std::atomic<int>> in_degree_;       // 剪枝时剩余的入度
+    std::vector<std::atomic<int>> out_degree_;      // 剪枝时剩余的出度
+    std::vector<std::atomic<int>> color_;           // 着色时每个顶点的颜色
+    std::vector<std::atomic<int>> stamp_;           // 顶点最近一次加入下一轮的轮次, 用于去重
+    std::vector<std::vector<int>> local_;           // 每个线程的缓冲区
+    std::vector<int> active_;                       // 尚未确定分量的顶点
+    std::vector<int> cc_;                           // 每个顶点所在的强连通分量
+    int num_cc_ = 0;                                // 强连通分量的个数
+    int trimmed_ = 0;                               // 剪枝得到的分量个数
+    int pivot_size_ = 0;                            // FW-BW得到的分量的顶点数
+    int color_rounds_ = 0;                          // 着色的轮数
+
+    static constexpr int chunk_size = 64;           // 每次领取的顶点个数
+
+public:
+    /**
+     * @brief 构造并行SCC对象, 创建自己的线程池
+     *
+     * @param graph 有向图
+     * @param thread_count 线程个数, 小于1时使用硬件支持的并发线程数
+     */
+    ParallelSCC(const Graph &graph, int thread_count = 0):
+        graph_(graph), own_pool_(std::make_unique<parallel::thread_pool>(thread_count)),
+        pool_(*own_pool_)
+    {
+    }
+
+    /**
+     * @brief 构造并行SCC对象, 使用外部的线程池
+     *
+     * @param graph 有向图
+     * @param pool 线程池
+     */
+    ParallelSCC(const Graph &graph, parallel::thread_pool &pool): graph_(graph), pool_(pool)
+    {
+    }
+
+    void calculate()
+    {
+        int n = graph_.vertex_count();
+        // 图可能在两次计算之间插入了边, 每次都重新建立反向视图, 代价与算法本身相同, 为O(V+E)
+        in_graph_ = std::make_unique<csr_graph>(csr_graph::make_reverse(graph_));
+        local_.resize(pool_.size());
+        if ((int) rep_.size() != n) {
+            rep_ = std::vector<std::atomic<int>>(n);
+            in_degree_ = std::vector<std::atomic<int>>(n);
+            out_degree_ = std::vector<std::atomic<int>>(n);
+            color_ = std::vector<std::atomic<int>>(n);
+            stamp_ = std::vector<std::atomic<int>>(n);
+        }
+        parallel::parallel_for(pool_, 0, n, [&](int, int v) {
+            rep_[v].store(-1, std::memory_order_relaxed);
+        });
+
+        trim();
+        forward_backward();
+        color_rounds_ = 0;
+        while (collect_active() > 0) {
+            color_rounds_++;
+            propagate_colors();
+            extract_components();
+        }
+        label();
+    }
+
+    /**
+     * @brief 强连通分量的个数
+     *
+     * @return 个数
+     */
+    int count() const { return num_cc_; }
+
+    /**
+     * @brief 顶点所在的强连通分量
+     *
+     * 分量按其中编号最小的顶点排序.
+     *
+     * @param v 顶点
+     *
+     * @return 强连通分量的编号, 从0开始
+     */
+    int id(int v) const { return cc_[v]; }
+
+    /**
+     * @brief 两个顶点是否强连通(互相可达)
+     *
+     * @param v 顶点
+     * @param w 顶点
+     *
+     * @return 如果强连通, 返回true, 否则返回false
+     */
+    bool strongly_connected(int v, int w) const { return cc_[v] == cc_[w]; }
+
+    /**
+     * @brief 最近一次calculate()中剪枝得到的(单个顶点的)分量个数
+     *
+     * @return 个数
+     */
+    int trimmed_count() const { return trimmed_; }
+
+    /**
+     * @brief 最近一次calculate()中FW-BW得到的分量的顶点数
+     *
+     * @return 顶点数
+     */
+    int pivot_component_size() const { return pivot_size_; }
+
+    /**
+     * @brief 最近一次calculate()中着色的轮数
+     *
+     * @return 轮数
+     */
+    int color_rounds() const { return color_rounds_; }
+
+    /**
+     * @brief 线程池
+     *
+     * @return 计算使用的线程池
+     */
+    parallel::thread_pool &pool() { return pool_; }
+
+private:
+    bool is_active(int v) const { return rep_[v].load(std::memory_order_relaxed) == -1; }
+
+    /**
+     * @brief 把v标记为属于代表顶点为r的分量
+     *
+     * @return 如果v之前没有分量, 返回true
+     */
+    bool claim(int v, int r)
+    {
+        int expected = -1;
+        return rep_[v].compare_exchange_strong(expected, r, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief 并行地对[first, last)分块处理, 每个线程把结果放入自己的缓冲区, 最后合并到out
+     */
+    template <typename Func>
+    void gather(int first, int last, std::vector<int> &out, Func f)
+    {
+        for (auto &buf: local_)
+            buf.clear();
+        parallel::parallel_for_chunked(pool_, first, last, chunk_size, [&](int tid, int i) {
+            f(i, local_[tid]);
+        });
+        out.clear();
+        for (auto &buf: local_)
+            out.insert(out.end(), buf.begin(), buf.end());
+    }
+
+    /**
+     * @brief 剪枝: 逐层删除入度或出度为0的顶点, 每个顶点单独组成一个分量
+     */
+    void trim()
+    {
+        int n = graph_.vertex_count();
+        parallel::parallel_for(pool_, 0, n, [&](int, int v) {
+            int out = 0;
+            for (auto w: graph_.get_adj_list(v)) {
+                (void) w;
+                out++;
+            }
+            out_degree_[v].store(out, std::memory_order_relaxed);
+            in_degree_[v].store(in_graph_->degree(v), std::memory_order_relaxed);
+        });
+
+        std::vector<int> frontier;
+        gather(0, n, frontier, [&](int v, std::vector<int> &buf) {
+            if ((in_degree_[v].load(std::memory_order_relaxed) == 0 ||
+                    out_degree_[v].load(std::memory_order_relaxed) == 0) && claim(v, v))
+                buf.push_back(v);
+        });
+
+        trimmed_ = 0;
+        std::vector<int> next;
+        while (!frontier.empty()) {
+            trimmed_ += static_cast<int>(frontier.size());
+            gather(0, static_cast<int>(frontier.size()), next, [&](int i, std::vector<int> &buf) {
+                int v = frontier[i];
+                for (auto w: graph_.get_adj_list(v)) {
+                    if (in_degree_[w].fetch_sub(1, std::memory_order_relaxed) == 1 && claim(w, w))
+                        buf.push_back(w);
+                }
+                for (auto u: in_graph_->get_adj_list(v)) {
+                    if (out_degree_[u].fetch_sub(1, std::memory_order_relaxed) == 1 && claim(u, u))
+                        buf.push_back(u);
+                }
+            });
+            frontier.swap(next);
+        }
+    }
+
+    /**
+     * @brief FW-BW: 求入度与出度之积最大的剩余顶点所在的分量
+     */
+    void forward_backward()
+    {
+        int n = graph_.vertex_count();
+        int thread_count = pool_.size();
+        std::vector<int> best(thread_count, -1);
+        std::vector<long long> best_score(thread_count, -1);
+        pool_.run([&](int tid) {
+            auto [begin, end] = parallel::split_range(0, n, tid, thread_count);
+            for (int v = begin; v < end; v++) {
+                if (!is_active(v)) continue;
+                long long score = (long long) in_graph_->degree(v) *
+                    out_degree_[v].load(std::memory_order_relaxed);
+                if (score > best_score[tid]) {
+                    best_score[tid] = score;
+                    best[tid] = v;
+                }
+            }
+        });
+        int pivot = best[std::max_element(best_score.begin(), best_score.end()) - best_score.begin()];
+        pivot_size_ = 0;
+        if (pivot < 0)
+            return;
+
+        ParallelBFS<Graph> forward(graph_, pool_);
+        forward.search_if(pivot, [&](int w) { return is_active(w); });
+
+        ParallelBFS<csr_graph> backward(*in_graph_, pool_);
+        backward.search_if(pivot, [&](int w) { return forward.is_visited(w) && is_active(w); });
+
+        const auto &scc = backward.reached();
+        pivot_size_ = static_cast<int>(scc.size());
+        parallel::parallel_for(pool_, 0, pivot_size_, [&](int, int i) {
+            rep_[scc[i]].store(pivot, std::memory_order_relaxed);
+        });
+    }
+
+    /**
+     * @brief 收集尚未确定分量的顶点, 并把它们的颜色初始化为自己
+     *
+     * @return 顶点数
+     */
+    int collect_active()
+    {
+        gather(0, graph_.vertex_count(), active_, [&](int v, std::vector<int> &buf) {
+            if (is_active(v)) {
+                color_[v].store(v, std::memory_order_relaxed);
+                stamp_[v].store(-1, std::memory_order_relaxed);
+                buf.push_back(v);
+            }
+        });
+        return static_cast<int>(active_.size());
+    }
+
+    /**
+     * @brief 沿出边传播较大的颜色, 只有颜色改变了的顶点参加下一轮
+     */
+    void propagate_colors()
+    {
+        std::vector<int> frontier = active_;
+        std::vector<int> next;
+        for (int round = 0; !frontier.empty(); round++) {
+            gather(0, static_cast<int>(frontier.size()), next, [&](int i, std::vector<int> &buf) {
+                int v = frontier[i];
+                int c = color_[v].load(std::memory_order_relaxed);
+                for (auto w: graph_.get_adj_list(v)) {
+                    if (!is_active(w)) continue;
+                    int old = color_[w].load(std::memory_order_relaxed);
+                    while (old < c) {
+                        if (color_[w].compare_exchange_weak(old, c, std::memory_order_relaxed)) {
+                            // 每个顶点在一轮中只加入一次
+                            if (stamp_[w].exchange(round, std::memory_order_relaxed) != round)
+                                buf.push_back(w);
+                            break;
+                        }
+                    }
+                }
+            });
+            frontier.swap(next);
+        }
+    }
+
+    /**
+     * @brief 每个颜色等于自己的顶点r沿入边在颜色为r的顶点中搜索, 得到r所在的分量
+     */
+    void extract_components()
+    {
+        std::vector<int> roots;
+        gather(0, static_cast<int>(active_.size()), roots, [&](int i, std::vector<int> &buf) {
+            int v = active_[i];
+            if (color_[v].load(std::memory_order_relaxed) == v)
+                buf.push_back(v);
+        });
+
+        // 不同颜色的顶点互不相交, 每个线程独立地处理若干个根
+        parallel::for_each_chunked(pool_, roots, 1, [&](int r, int tid) {
+            auto &queue = local_[tid];
+            queue.assign(1, r);
+            rep_[r].store(r, std::memory_order_relaxed);
+            for (int head = 0; head < (int) queue.size(); head++) {
+                for (auto u: in_graph_->get_adj_list(queue[head])) {
+                    if (color_[u].load(std::memory_order_relaxed) == r && claim(u, r))
+                        queue.push_back(u);
+                }
+            }
+        });
+    }
+
+    /**
+     * @brief 把代表顶点换成从0开始的编号, 分量按其中编号最小的顶点排序
+     */
+    void label()
+    {
+        int n = graph_.vertex_count();
+        cc_.assign(n, -1);
+        num_cc_ = 0;
+        for (int v = 0; v < n; v++) {
+            int r = rep_[v].load(std::memory_order_relaxed);
+            if (cc_[r] == -1)
+                cc_[r] = num_cc_++;
+            cc_[v] = cc_[r];
+        }
+    }
+};
+
+}   // namespace unweight
+
+#endif
@@ -0,0 +1,216 @@
+/**
+ * @file unweight_digraph_parallel_topo_sort.hpp
+ * @brief 多线程的Kahn拓扑排序算法, 把有向无环图划分成层
+ * @author hexu_1985@sina.com
+ * @version 1.0
+ * @date 2020-10-02
+ */
+#ifndef UNWEIGHT_DIGRAPH_PARALLEL_TOPO_SORT_INC
+#define UNWEIGHT_DIGRAPH_PARALLEL_TOPO_SORT_INC
+
+#include <vector>
+#include <memory>
+#include <atomic>
+#include <algorithm>
+#include "parallel_utils.hpp"
+
+namespace unweight {
+
+/**
+ * @brief 多线程的Kahn拓扑排序算法
+ *
+ * 第0层是所有入度为0的顶点; 删除第i层的顶点和它们的出边以后, 入度变为0的顶点组成第i+1层.
+ * 同一层的顶点之间没有依赖关系, 可以同时执行.
+ * 入度用原子计数器保存, 每一层的顶点分块交给线程池中的线程处理, 把某个顶点的入度减到0的线程
+ * 把它放入自己的下一层缓冲区, 一层结束后按前缀和合并, 与ParallelBFS的方式相同.
+ *
+ * @tparam Graph 图类型
+ */
+template <typename Graph>
+class ParallelTopoSort {
+public:
+    /**
+     * @brief 一层中的顶点, 指向order()中的一段
+     */
+    struct level_list {
+        const int *first_;
+        const int *last_;
+
+        level_list(const int *first, const int *last): first_(first), last_(last) {}
+
+        const int *begin() const { return first_; }
+
+        const int *end() const { return last_; }
+
+        int size() const { return static_cast<int>(last_ - first_); }
+    };
+
+private:
+    const Graph &graph_;
+    std::unique_ptr<parallel::thread_pool> own_pool_;
+    parallel::thread_pool &pool_;
+    std::vector<std::atomic<int>> in_degree_;   // 剩余的入度
+    std::vector<int> order_;                    // 按层排列的顶点
+    std::vector<int> level_offsets_;            // 第i层为order_[level_offsets_[i], level_offsets_[i+1])
+    std::vector<int> level_of_;                 // 每个顶点所在的层
+    std::vector<std::vector<int>> local_next_;  // 每个线程的下一层缓冲区
+
+    static constexpr int chunk_size = 64;       // 每次领取的顶点个数
+
+public:
+    /**
+     * @brief 构造并行拓扑排序对象, 创建自己的线程池
+     *
+     * @param graph 有向图
+     * @param thread_count 线程个数, 小于1时使用硬件支持的并发线程数
+     */
+    ParallelTopoSort(const Graph &graph, int thread_count = 0):
+        graph_(graph), own_pool_(std::make_unique<parallel::thread_pool>(thread_count)),
+        pool_(*own_pool_)
+    {
+    }
+
+    /**
+     * @brief 构造并行拓扑排序对象, 使用外部的线程池
+     *
+     * @param graph 有向图
+     * @param pool 线程池
+     */
+    ParallelTopoSort(const Graph &graph, parallel::thread_pool &pool): graph_(graph), pool_(pool)
+    {
+    }
+
+    /**
+     * @brief 计算拓扑顺序并划分层
+     *
+     * 同一层中顶点的顺序不确定.
+     *
+     * @return 如果图是有向无环图, 返回true; 如果有环, 返回false,
+     *         此时order()只包含不在环上也不依赖于环的顶点
+     */
+    bool sort()
+    {
+        int n = graph_.vertex_count();
+        int thread_count = pool_.size();
+        local_next_.resize(thread_count);
+
+        // 并行地计算入度
+        if ((int) in_degree_.size() != n)
+            in_degree_ = std::vector<std::atomic<int>>(n);
+        parallel::parallel_for(pool_, 0, n, [&](int, int v) {
+            in_degree_[v].store(0, std::memory_order_relaxed);
+        });
+        parallel::parallel_for(pool_, 0, n, [&](int, int v) {
+            for (auto w: graph_.get_adj_list(v))
+                in_degree_[w].fetch_add(1, std::memory_order_relaxed);
+        });
+
+        // 第0层: 所有入度为0的顶点
+        order_.clear();
+        level_offsets_.assign(1, 0);
+        level_of_.assign(n, -1);
+        pool_.run([&](int tid) {
+            auto &next = local_next_[tid];
+            next.clear();
+            auto [begin, end] = parallel::split_range(0, n, tid, thread_count);
+            for (int v = begin; v < end; v++) {
+                if (in_degree_[v].load(std::memory_order_relaxed) == 0)
+                    next.push_back(v);
+            }
+        });
+        append_level();
+
+        // 当前层为order_[first, last)
+        int first = 0;
+        int last = static_cast<int>(order_.size());
+        while (first < last) {
+            for (auto &next: local_next_)
+                next.clear();
+            parallel::parallel_for_chunked(pool_, first, last, chunk_size, [&](int tid, int i) {
+                for (auto w: graph_.get_adj_list(order_[i])) {
+                    // 最后一个依赖完成的线程负责w
+                    if (in_degree_[w].fetch_sub(1, std::memory_order_acq_rel) == 1)
+                        local_next_[tid].push_back(w);
+                }
+            });
+            append_level();
+
+            first = last;
+            last = static_cast<int>(order_.size());
+        }
+
+        return (int) order_.size() == n;
+    }
+
+    /**
+     * @brief 最近一次sort()得到的拓扑顺序
+     *
+     * @return 按层排列的顶点
+     */
+    const std::vector<int> &order() const { return order_; }
+
+    /**
+     * @brief 层数
+     *
+     * @return 层数, 也是最长路径上的顶点数
+     */
+    int level_count() const { return static_cast<int>(level_offsets_.size()) - 1; }
+
+    /**
+     * @brief 第i层的顶点, 它们之间没有依赖关系
+     *
+     * @param i 层号, 从0开始
+     *
+     * @return 顶点列表
+     */
+    level_list level(int i) const
+    {
+        return level_list(order_.data() + level_offsets_[i], order_.data() + level_offsets_[i+1]);
+    }
+
+    /**
+     * @brief 顶点所在的层
+     *
+     * @param v 顶点
+     *
+     * @return 层号, 顶点在环上或依赖于环时为-1
+     */
+    int level_of(int v) const { return level_of_[v]; }
+
+    /**
+     * @brief 线程池
+     *
+     * @return 排序使用的线程池
+     */
+    parallel::thread_pool &pool() { return pool_; }
+
+private:
+    /**
+     * @brief 把各线程的缓冲区合并成新的一层: 先求前缀和, 再并行复制
+     */
+    void append_level()
+    {
+        int thread_count = pool_.size();
+        int level = level_count();
+        std::vector<int> offsets(thread_count+1);
+        offsets[0] = static_cast<int>(order_.size());
+        for (int tid = 0; tid < thread_count; tid++)
+            offsets[tid+1] = offsets[tid] + static_cast<int>(local_next_[tid].size());
+        if (offsets[thread_count] == offsets[0])
+            return;
+
+        order_.resize(offsets[thread_count]);
+        pool_.run([&](int tid) {
+            int pos = offsets[tid];
+            for (auto v: local_next_[tid]) {
+                order_[pos++] = v;
+                level_of_[v] = level;
+            }
+        });
+        level_offsets_.push_back(offsets[thread_count]);
+    }
+};
+
+}   // namespace unweight
+
+#endif
@@ -0,0 +1,200 @@
+/**
+ * @file unweight_digraph_scc.hpp
+ * @brief 有向图的强连通分量(Strongly Connected Components, SCC)算法, 迭代式的Tarjan算法
+ * @author hexu_1985@sina.com
+ * @version 1.0
+ * @date 2020-10-06
+ */
+#ifndef UNWEIGHT_DIGRAPH_SCC_INC
+#define UNWEIGHT_DIGRAPH_SCC_INC
+
+#include <vector>
+#include <memory>
+#include <utility>
+#include <iterator>
+#include <algorithm>
+#include "unweight_csr_graph.hpp"
+#include "unweight_graph_utils.hpp"
+
+namespace unweight {
+
+/**
+ * @brief 有向图的强连通分量算法(Tarjan算法, 迭代式版本)
+ *
+ * 一次DFS给每个顶点分配发现序号index(v), 并计算low(v): 从v的DFS子树出发经过一条边
+ * 可以到达的、仍在SCC堆栈中的顶点的最小发现序号. DFS离开v时如果low(v) = index(v),
+ * SCC堆栈中从v到栈顶的顶点就是一个强连通分量.
+ * DFS使用显式的堆栈, 每一帧记录一个顶点和它的邻接列表中下一个要检查的位置,
+ * 所有数组在多次计算之间重复使用, 时间复杂度为O(V+E), 检查边时不分配内存.
+ *
+ * @tparam Graph 图类型
+ */
+template <typename Graph>
+class SCC {
+private:
+    using adj_iterator = decltype(std::begin(std::declval<const Graph &>().get_adj_list(0)));
+
+    /**
+     * @brief DFS堆栈中的一帧: 顶点v和它的邻接列表中尚未检查的部分
+     */
+    struct frame {
+        int v;
+        adj_iterator cur;
+        adj_iterator last;
+    };
+
+    const Graph &graph_;
+    std::vector<int> index_;        // 每个顶点的发现序号, 未探索为-1
+    std::vector<int> low_;          // 每个顶点的low值
+    std::vector<int> cc_;           // 每个顶点所在的强连通分量, 仍在SCC堆栈中为-1
+    std::vector<int> scc_stack_;    // 尚未归入强连通分量的顶点
+    std::vector<frame> frames_;     // DFS堆栈
+    int num_cc_ = 0;                // 强连通分量的个数
+
+public:
+    SCC(const Graph &graph): graph_(graph)
+    {
+    }
+
+    void calculate()
+    {
+        int n = graph_.vertex_count();
+        index_.assign(n, -1);
+        low_.resize(n);
+        cc_.assign(n, -1);
+        scc_stack_.clear();
+        num_cc_ = 0;
+
+        int counter = 0;
+        for (int s = 0; s < n; s++) {
+            if (index_[s] == -1)
+                search(s, counter);
+        }
+
+        // Tarjan算法按逆拓扑顺序得到强连通分量, 把编号反过来
+        for (int v = 0; v < n; v++)
+            cc_[v] = num_cc_ - 1 - cc_[v];
+    }
+
+    /**
+     * @brief 强连通分量的个数
+     *
+     * @return 个数
+     */
+    int count() const { return num_cc_; }
+
+    /**
+     * @brief 顶点所在的强连通分量
+     *
+     * 编号是缩点图的一个拓扑顺序: 如果有从分量a到分量b的边, 那么a < b.
+     *
+     * @param v 顶点
+     *
+     * @return 强连通分量的编号, 从0开始
+     */
+    int id(int v) const { return cc_[v]; }
+
+    /**
+     * @brief 两个顶点是否强连通(互相可达)
+     *
+     * @param v 顶点
+     * @param w 顶点
+     *
+     * @return 如果强连通, 返回true, 否则返回false
+     */
+    bool strongly_connected(int v, int w) const { return cc_[v] == cc_[w]; }
+
+    /**
+     * @brief 缩点图(condensation): 每个强连通分量缩成一个顶点, 去掉分量内部的边和重复的边
+     *
+     * 时间复杂度为O(V+E).
+     *
+     * @tparam DagGraph 缩点图的类型
+     *
+     * @return 有向无环图, 顶点v对应编号为v的强连通分量
+     */
+    template <typename DagGraph = csr_graph>
+    std::shared_ptr<DagGraph> condensation() const
+    {
+        int n = graph_.vertex_count();
+
+        // 按分量对顶点做计数排序, 然后逐个分量检查出边
+        std::vector<int> offset(num_cc_ + 1, 0);
+        for (int v = 0; v < n; v++)
+            offset[cc_[v] + 1]++;
+        for (int c = 0; c < num_cc_; c++)
+            offset[c+1] += offset[c];
+        std::vector<int> members(n);
+        std::vector<int> next(offset.begin(), offset.end() - 1);
+        for (int v = 0; v < n; v++)
+            members[next[cc_[v]]++] = v;
+
+        // stamp[b] == a表示分量a到分量b的边已经加入, 去掉重复的边只需O(1)
+        std::vector<int> stamp(num_cc_, -1);
+        std::vector<typename DagGraph::edge_type> edges;
+        for (int a = 0; a < num_cc_; a++) {
+            for (int i = offset[a]; i < offset[a+1]; i++) {
+                int v = members[i];
+                for (auto w: graph_.get_adj_list(v)) {
+                    int b = cc_[w];
+                    if (b != a && stamp[b] != a) {
+                        stamp[b] = a;
+                        edges.push_back(DagGraph::make_edge(a, b));
+                    }
+                }
+            }
+        }
+        return make_digraph<DagGraph>(num_cc_, edges);
+    }
+
+private:
+    void push(int v, int &counter)
+    {
+        index_[v] = low_[v] = counter++;
+        scc_stack_.push_back(v);
+        auto &&adj = graph_.get_adj_list(v);
+        frames_.push_back(frame{v, std::begin(adj), std::end(adj)});
+    }
+
+    void search(int s, int &counter)
+    {
+        frames_.clear();
+        push(s, counter);
+
+        while (!frames_.empty()) {
+            auto &top = frames_.back();
+            int v = top.v;
+            if (top.cur != top.last) {
+                // 检查栈顶顶点的下一条边
+                int w = *top.cur;
+                ++top.cur;
+                if (index_[w] == -1)
+                    push(w, counter);
+                else if (cc_[w] == -1)
+                    low_[v] = std::min(low_[v], index_[w]);     // w仍在SCC堆栈中
+                continue;
+            }
+
+            // v的所有边都已检查
+            frames_.pop_back();
+            if (low_[v] == index_[v]) {
+                // SCC堆栈中从v到栈顶的顶点组成一个强连通分量
+                int w;
+                do {
+                    w = scc_stack_.back();
+                    scc_stack_.pop_back();
+                    cc_[w] = num_cc_;
+                } while (w != v);
+                num_cc_++;
+            }
+            if (!frames_.empty()) {
+                int parent = frames_.back().v;
+                low_[parent] = std::min(low_[parent], low_[v]);
+            }
+        }
+    }
+};
+
+}   // namespace unweight
+
+#endif
@@ -10,6 +10,7 @@
 
 #include <vector>
 #include <algorithm>
+#include "unweight_graph_visitor.hpp"
 
 namespace unweight {
 
@@ -17,20 +18,31 @@ namespace unweight {
  * @brief 有向图拓扑排序算法
  *
  * @tparam Graph 图类型
+ * @tparam Visitor 访问者类型, 参见null_visitor
  */
-template <typename Graph>
+template <typename Graph, typename Visitor = null_visitor>
 class TopoSort {
 private:
     const Graph &graph_;
+    Visitor vis_;           // 访问者
     std::vector<bool> visited_;
     int cur_label_;         // 记录顺序
     std::vector<int> f_;    // 每个顶点的顺序
 
 public:
-    TopoSort(const Graph &graph): graph_(graph)
+    TopoSort(const Graph &graph, Visitor vis = Visitor()): graph_(graph), vis_(vis)
     {
     }
 
+    /**
+     * @brief 访问者
+     *
+     * @return 排序使用的访问者
+     */
+    Visitor &visitor() { return vis_; }
+
+    const Visitor &visitor() const { return vis_; }
+
     void sort()
     {
         // 把所有顶点标记为未探索
@@ -38,11 +50,13 @@ public:
         std::fill(std::begin(visited_), std::end(visited_), false);
 
         f_.assign(graph_.vertex_count(), -1);
+        vis_.initialize(graph_.vertex_count());
 
         cur_label_ = graph_.vertex_count();
 
         for (int v = 0; v < graph_.vertex_count(); v++) {
             if (!visited_[v]) {
+                vis_.start_vertex(v);
                 dfs_topo(v);
             }
         }
@@ -53,15 +67,19 @@ private:
     {
         // 把s标记为已探索
         visited_[s] = true;
+        vis_.discover_vertex(s);
 
         // 遍历s的邻接列表
         for (auto v: graph_.get_adj_list(s)) {
+            vis_.examine_edge(s, v);
             if (!visited_[v]) {
+                vis_.tree_edge(s, v);
                 dfs_topo(v);
             }
         }
         f_[s] = cur_label_;             // s的位置符合顺序
         cur_label_ = cur_label_ - 1;    // 从右向左进行操作
+        vis_.finish_vertex(s);
     }
 };
 
@@ -0,0 +1,167 @@
+/**
+ * @file unweight_digraph_topo_sort_iter.hpp
+ * @brief 有向图拓扑排序算法, 迭代式版本(带环检测)
+ * @author hexu_1985@sina.com
+ * @version 1.0
+ * @date 2020-09-30
+ */
+#ifndef UNWEIGHT_DIGRAPH_TOPO_SORT_ITER_INC
+#define UNWEIGHT_DIGRAPH_TOPO_SORT_ITER_INC
+
+#include <vector>
+#include <cstdint>
+#include <utility>
+#include <iterator>
+#include <algorithm>
+
+namespace unweight {
+
+/**
+ * @brief 有向图拓扑排序算法, 迭代式版本
+ *
+ * 用显式的堆栈代替递归, 堆栈中的每一帧记录一个顶点和它的邻接列表中下一个要检查的位置,
+ * 得到的顺序与递归版本相同, 很长的链也不会导致栈溢出.
+ * 每个顶点有三种状态: 未探索, 正在探索(在堆栈中), 已完成. 探索到一个正在探索的顶点时,
+ * 说明图中有环, 堆栈中从该顶点到栈顶的顶点就构成一个环.
+ *
+ * @tparam Graph 图类型
+ */
+template <typename Graph>
+class TopoSort {
+private:
+    using adj_iterator = decltype(std::begin(std::declval<const Graph &>().get_adj_list(0)));
+
+    /**
+     * @brief 顶点的状态, 使用字节数组而不是std::vector<bool>, 避免位操作的开销
+     */
+    enum : uint8_t { unvisited = 0, active = 1, finished = 2 };
+
+    /**
+     * @brief 堆栈中的一帧: 顶点v和它的邻接列表中尚未检查的部分
+     */
+    struct frame {
+        int v;
+        adj_iterator cur;
+        adj_iterator last;
+    };
+
+    const Graph &graph_;
+    std::vector<uint8_t> state_;    // 每个顶点的状态
+    std::vector<frame> stack_;      // 显式的堆栈
+    int cur_label_;                 // 记录顺序
+    std::vector<int> f_;            // 每个顶点的顺序
+    std::vector<int> order_;        // 按拓扑顺序排列的顶点
+    std::vector<int> cycle_;        // 发现的环
+
+public:
+    TopoSort(const Graph &graph): graph_(graph)
+    {
+    }
+
+    /**
+     * @brief 计算拓扑顺序
+     *
+     * @return 如果图是有向无环图, 返回true; 如果图中有环, 返回false, 可以用cycle()得到一个环
+     */
+    bool sort()
+    {
+        int n = graph_.vertex_count();
+
+        // 把所有顶点标记为未探索
+        state_.assign(n, unvisited);
+        f_.assign(n, -1);
+        order_.assign(n, -1);
+        cycle_.clear();
+
+        cur_label_ = n;
+
+        for (int v = 0; v < n; v++) {
+            if (state_[v] == unvisited && !dfs_topo(v)) {
+                order_.clear();
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief 最近一次sort()是否发现了环
+     *
+     * @return 如果有环, 返回true, 否则返回false
+     */
+    bool has_cycle() const { return !cycle_.empty(); }
+
+    /**
+     * @brief 最近一次sort()发现的环
+     *
+     * @return 环上的顶点, 依次相邻, 最后一个顶点有一条边指向第一个顶点; 无环时为空
+     */
+    const std::vector<int> &cycle() const { return cycle_; }
+
+    /**
+     * @brief 最近一次sort()得到的拓扑顺序
+     *
+     * @return 按拓扑顺序排列的顶点, 有环时为空
+     */
+    const std::vector<int> &order() const { return order_; }
+
+    /**
+     * @brief 顶点在拓扑顺序中的位置
+     *
+     * @param v 顶点
+     *
+     * @return 位置, 从1开始
+     */
+    int label(int v) const { return f_[v]; }
+
+private:
+    void push(int v)
+    {
+        state_[v] = active;
+        auto &&adj = graph_.get_adj_list(v);
+        stack_.push_back(frame{v, std::begin(adj), std::end(adj)});
+    }
+
+    /**
+     * @brief 从s开始的迭代式DFS
+     *
+     * @return 如果发现了环, 返回false, 否则返回true
+     */
+    bool dfs_topo(int s)
+    {
+        stack_.clear();
+        push(s);
+
+        while (!stack_.empty()) {
+            auto &top = stack_.back();
+            if (top.cur != top.last) {
+                // 检查栈顶顶点的下一条边
+                int v = *top.cur;
+                ++top.cur;
+                if (state_[v] == unvisited) {
+                    push(v);
+                } else if (state_[v] == active) {
+                    // v在堆栈中, 堆栈中从v到栈顶的顶点构成一个环
+                    auto it = std::find_if(stack_.begin(), stack_.end(),
+                            [v](const frame &fr) { return fr.v == v; });
+                    for (; it != stack_.end(); ++it)
+                        cycle_.push_back(it->v);
+                    return false;
+                }
+            } else {
+                // 栈顶顶点的所有边都已检查, 它的位置符合顺序
+                int v = top.v;
+                stack_.pop_back();
+                state_[v] = finished;
+                f_[v] = cur_label_;
+                order_[cur_label_-1] = v;
+                cur_label_ = cur_label_ - 1;    // 从右向左进行操作
+            }
+        }
+        return true;
+    }
+};
+
+}   // namespace unweight
+
+#endif
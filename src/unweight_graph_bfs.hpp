@@ -9,53 +9,283 @@
 #define UNWEIGHT_GRAPH_BFS_INC
 
 #include <vector>
-#include <queue>
+#include <memory>
 #include <algorithm>
+#include <cstdint>
+#include "unweight_traversal_workspace.hpp"
+#include "unweight_graph_visitor.hpp"
 
 namespace unweight {
 
 /**
  * @brief 宽度优先的搜索(Breadth-first Search, BFS)算法
  *
+ * search(), search_paths()和search_until()在探索过程中调用访问者的成员函数,
+ * 默认的null_visitor不产生任何开销.
+ *
  * @tparam Graph 图类型
+ * @tparam Visitor 访问者类型, 参见null_visitor
  */
-template <typename Graph>
+template <typename Graph, typename Visitor = null_visitor>
 class BFS {
 private:
     const Graph &graph_;
-    std::vector<bool> visited_;
+    std::unique_ptr<traversal_workspace> own_ws_;
+    traversal_workspace &ws_;               // 已探索标记和队列
+    Visitor vis_;                           // 访问者
+    uint32_t epoch_ = 0;                    // 最近一次搜索时工作区的代数
+
+    // search_paths()和search_until()记录的最短路径信息
+    int source_ = -1;                       // 起点
+    std::vector<int> dist_;                 // 每个已探索顶点到起点的跳数
+    std::vector<int> parent_;               // 每个已探索顶点在最短路径树中的父顶点, 起点为-1
 
 public:
-    BFS(const Graph &graph): graph_(graph)
+    BFS(const Graph &graph, Visitor vis = Visitor()):
+        graph_(graph), own_ws_(std::make_unique<traversal_workspace>()), ws_(*own_ws_),
+        vis_(vis)
+    {
+    }
+
+    /**
+     * @brief 构造一个使用外部工作区的BFS对象
+     *
+     * 反复搜索时, 已探索标记只需O(1)时间重置, 队列也不会重新分配.
+     *
+     * @param graph 图
+     * @param ws 工作区, 可以与其他搜索对象共享
+     * @param vis 访问者
+     */
+    BFS(const Graph &graph, traversal_workspace &ws, Visitor vis = Visitor()):
+        graph_(graph), ws_(ws), vis_(vis)
     {
     }
 
+    /**
+     * @brief 访问者
+     *
+     * @return 搜索使用的访问者
+     */
+    Visitor &visitor() { return vis_; }
+
+    const Visitor &visitor() const { return vis_; }
+
     void search(int s)
+    {
+        // 不记录距离和父顶点, distance()和path_to()不再有效
+        source_ = -1;
+        run<false>(s, -1, [](int) { return false; });
+    }
+
+    /**
+     * @brief 宽度优先搜索, 同时记录每个顶点到起点的跳数和最短路径树中的父顶点
+     *
+     * 距离和父顶点保存在两个长度为V的数组中, 队列使用工作区中预先分配的数组,
+     * 搜索过程中不会为每条边分配内存. 两个数组不会在每次搜索前清空,
+     * 只有已探索顶点对应的值有效.
+     *
+     * @param s 起点
+     */
+    void search_paths(int s)
+    {
+        search_until(s, -1, [](int) { return false; });
+    }
+
+    /**
+     * @brief 有界的宽度优先搜索: 只探索到起点的跳数不超过max_depth的顶点,
+     * 探索到第一个满足stop(w)的顶点w时立即停止
+     *
+     * 与search_paths()一样记录跳数和父顶点, 已探索的顶点可以用distance()和path_to()查询.
+     * 只访问被探索到的顶点和它们的邻接列表, 配合工作区重复使用时,
+     * 一次查询的代价与查询涉及的邻域大小成正比, 与图的规模无关.
+     *
+     * @param s 起点
+     * @param max_depth 最大跳数, 小于0时不限制
+     * @param stop 停止条件, 对每个新探索到的顶点(包括起点)调用一次
+     *
+     * @return 满足停止条件的顶点, 没有时返回-1
+     */
+    template <typename Pred>
+    int search_until(int s, int max_depth, Pred stop)
+    {
+        int n = graph_.vertex_count();
+        source_ = s;
+        if ((int) dist_.size() < n) {
+            dist_.resize(n);
+            parent_.resize(n);
+        }
+        return run<true>(s, max_depth, stop);
+    }
+
+    /**
+     * @brief 探索s的k跳邻域: 所有到s的跳数不超过max_depth的顶点
+     *
+     * @param s 起点
+     * @param max_depth 最大跳数
+     *
+     * @return 邻域中的顶点(包括s), 按跳数由近到远排列
+     */
+    traversal_workspace::vertex_list search_within(int s, int max_depth)
+    {
+        search_until(s, max_depth, [](int) { return false; });
+        return ws_.queued();
+    }
+
+    /**
+     * @brief t是否可以在max_depth跳之内从s到达
+     *
+     * 找到t后立即停止搜索, 之后可以用path_to(t)得到路径.
+     *
+     * @param s 起点
+     * @param t 终点
+     * @param max_depth 最大跳数, 小于0时不限制
+     *
+     * @return 如果可以到达, 返回true, 否则返回false
+     */
+    bool is_reachable_within(int s, int t, int max_depth)
+    {
+        return search_until(s, max_depth, [t](int v) { return v == t; }) == t;
+    }
+
+    /**
+     * @brief 最近一次搜索探索到的所有顶点, 按探索顺序排列
+     *
+     * 列表保存在工作区的队列中, 长度与探索到的顶点数成正比.
+     * 共享工作区的其他对象搜索之后为空.
+     *
+     * @return 顶点列表
+     */
+    traversal_workspace::vertex_list visited_vertices() const
+    {
+        return is_current() ? ws_.queued() : traversal_workspace::vertex_list(nullptr, nullptr);
+    }
+
+    /**
+     * @brief 最近一次search_paths()或search_until()得到的每个顶点到起点的跳数
+     *
+     * @return 距离数组, 只有is_visited(v)为true的顶点的值有效
+     */
+    const std::vector<int> &distances() const { return dist_; }
+
+    /**
+     * @brief 最近一次search_paths()或search_until()得到的最短路径树
+     *
+     * @return 父顶点数组, 只有is_visited(v)为true的顶点的值有效, 起点为-1
+     */
+    const std::vector<int> &parents() const { return parent_; }
+
+    /**
+     * @brief 最近一次search_paths()或search_until()中顶点v到起点的跳数
+     *
+     * @param v 顶点
+     *
+     * @return 跳数, 不可达, 最近一次搜索是search(), 或者共享工作区的其他对象搜索之后为-1
+     */
+    int distance(int v) const { return has_paths() && ws_.is_visited(v) ? dist_[v] : -1; }
+
+    /**
+     * @brief 从最近一次search_paths()或search_until()的起点到t的一条最短路径
+     *
+     * @param t 终点
+     *
+     * @return 路径上的顶点(包括起点和终点), t不可达, 最近一次搜索是search(),
+     * 或者共享工作区的其他对象搜索之后为空
+     */
+    std::vector<int> path_to(int t) const
+    {
+        std::vector<int> path;
+        if (!has_paths() || !ws_.is_visited(t))
+            return path;
+
+        path.resize(dist_[t] + 1);
+        for (int v = t, i = dist_[t]; v != -1; v = parent_[v], i--)
+            path[i] = v;
+        return path;
+    }
+
+    /**
+     * @brief 顶点是否在最近一次搜索中被探索到(从起点可达)
+     *
+     * @param v 顶点
+     *
+     * @return 如果v可达, 返回true, 否则返回false; 共享工作区的其他对象搜索之后总是返回false
+     */
+    bool is_visited(int v) const { return is_current() && ws_.is_visited(v); }
+
+private:
+    /**
+     * @brief 所有搜索共用的宽度优先搜索过程
+     *
+     * @tparam RecordPaths 是否记录跳数和父顶点; 为false时max_depth必须小于0
+     * @param s 起点
+     * @param max_depth 最大跳数, 小于0时不限制
+     * @param stop 停止条件, 对每个新探索到的顶点(包括起点)调用一次
+     *
+     * @return 满足停止条件的顶点, 没有时返回-1
+     */
+    template <bool RecordPaths, typename Pred>
+    int run(int s, int max_depth, Pred stop)
     {
         // 把s标记为已探索，所有其他顶点标记为未探索
-        visited_.resize(graph_.vertex_count());
-        std::fill(std::begin(visited_), std::end(visited_), false);
-        visited_[s] = true;
+        ws_.reset(graph_.vertex_count());
+        epoch_ = ws_.epoch();
+        vis_.initialize(graph_.vertex_count());
+        vis_.start_vertex(s);
+        ws_.visit(s);
+        vis_.discover_vertex(s);
+        if constexpr (RecordPaths) {
+            dist_[s] = 0;
+            parent_[s] = -1;
+        }
 
         // Q := 一个队列数据结构，用s进行初始化
-        std::queue<int> Q;
-        Q.push(s);
+        ws_.enqueue(s);
+        if (stop(s))
+            return s;
 
         // 只要队列不为空，就一直处理
-        while (!Q.empty()) {
+        while (!ws_.queue_empty()) {
             // 从Q的头部删除一个顶点，称之为v
-            auto v = Q.front(); Q.pop();
+            auto v = ws_.dequeue();
+            if constexpr (RecordPaths) {
+                // 队列中的顶点按跳数排列, 之后的顶点都不需要再扩展
+                if (max_depth >= 0 && dist_[v] >= max_depth)
+                    break;
+            }
 
             // 遍历v的邻接列表
             for (auto w: graph_.get_adj_list(v)) {
-                if (!visited_[w]) {
+                vis_.examine_edge(v, w);
+                if (!ws_.is_visited(w)) {
                     // 如果w为未探索，把w标记为已探索，并且把w添加到Q的尾部
-                    visited_[w] = true;
-                    Q.push(w);
+                    ws_.visit(w);
+                    if constexpr (RecordPaths) {
+                        dist_[w] = dist_[v] + 1;
+                        parent_[w] = v;
+                    }
+                    vis_.tree_edge(v, w);
+                    vis_.discover_vertex(w);
+                    ws_.enqueue(w);
+                    if (stop(w))
+                        return w;
                 }
             }
+            vis_.finish_vertex(v);
         }
+
+        return -1;
     }
+
+    /**
+     * @brief 工作区中的标记和队列是否仍然属于本对象最近一次的搜索
+     */
+    bool is_current() const { return epoch_ != 0 && ws_.epoch() == epoch_; }
+
+    /**
+     * @brief 最近一次搜索是否记录了距离和父顶点, 并且结果仍然有效
+     */
+    bool has_paths() const { return source_ != -1 && is_current(); }
+
 };
 
 }   // namespace unweight
@@ -0,0 +1,199 @@
+/**
+ * @file unweight_graph_bidir_bfs.hpp
+ * @brief 双向宽度优先搜索(Bidirectional BFS)算法, 计算两点之间的最短路径
+ * @author hexu_1985@sina.com
+ * @version 1.0
+ * @date 2020-09-22
+ */
+#ifndef UNWEIGHT_GRAPH_BIDIR_BFS_INC
+#define UNWEIGHT_GRAPH_BIDIR_BFS_INC
+
+#include <vector>
+#include <memory>
+#include <algorithm>
+#include "unweight_csr_graph.hpp"
+#include "unweight_traversal_workspace.hpp"
+
+namespace unweight {
+
+/**
+ * @brief 双向宽度优先搜索算法, 计算两点之间的最短路径(跳数最少)
+ *
+ * 同时从起点沿出边和从终点沿入边按层搜索, 每次扩展顶点较少的一侧的一层;
+ * 一侧探索到另一侧已经探索过的顶点时, 两侧相遇, 经过相遇点的路径就是最短路径,
+ * 立即停止搜索.
+ * 在小世界图上两侧各自只需要探索到一半的深度, 访问的顶点和边远少于单向BFS.
+ *
+ * @tparam Graph 图类型
+ */
+template <typename Graph>
+class BidirectionalBFS {
+private:
+    /**
+     * @brief 一侧的搜索状态
+     */
+    struct side {
+        traversal_workspace ws;         // 已探索标记
+        std::vector<int> dist;          // 已探索顶点到这一侧起点的跳数
+        std::vector<int> parent;        // 已探索顶点在这一侧搜索树中的父顶点
+        std::vector<int> frontier;      // 当前层
+        std::vector<int> next;          // 下一层
+    };
+
+    const Graph &graph_;
+    std::unique_ptr<csr_graph> in_graph_;   // 有向图的入边视图
+    side fwd_;                              // 从起点出发的搜索
+    side bwd_;                              // 从终点出发的搜索(沿入边)
+    int best_ = -1;                         // 最近一次查询的最短路径跳数
+    int meet_ = -1;                         // 两侧搜索相遇的顶点
+    long long edge_checks_ = 0;             // 最近一次查询检查过的边数
+
+public:
+    /**
+     * @brief 构造双向BFS对象, 有向图同时创建入边视图
+     *
+     * @param graph 图
+     */
+    BidirectionalBFS(const Graph &graph): graph_(graph)
+    {
+        refresh();
+    }
+
+    /**
+     * @brief 重新创建有向图的入边视图
+     *
+     * 入边视图是创建时的图的快照. 查询时如果图的顶点数或边数发生了变化会自动调用refresh(),
+     * 但删除和插入的边数相同时无法发现, 这时修改图之后需要手动调用.
+     */
+    void refresh()
+    {
+        if (graph_.is_directed())
+            in_graph_ = std::make_unique<csr_graph>(csr_graph::make_reverse(graph_));
+        else
+            in_graph_.reset();
+    }
+
+    /**
+     * @brief 计算从s到t的一条最短路径
+     *
+     * @param s 起点
+     * @param t 终点
+     *
+     * @return 路径上的顶点(包括起点和终点), t不可达时为空
+     */
+    std::vector<int> shortest_path(int s, int t)
+    {
+        int n = graph_.vertex_count();
+        if (graph_.is_directed() != (in_graph_ != nullptr) || (in_graph_ &&
+                (in_graph_->vertex_count() != n || in_graph_->edge_count() != graph_.edge_count())))
+            refresh();
+
+        init_side(fwd_, s, n);
+        init_side(bwd_, t, n);
+        best_ = -1;
+        meet_ = -1;
+        edge_checks_ = 0;
+
+        if (s == t) {
+            best_ = 0;
+            meet_ = s;
+        }
+
+        // 每次扩展较小的一侧的一层, 直到两侧相遇或者某一侧无法继续扩展
+        while (best_ < 0 && !fwd_.frontier.empty() && !bwd_.frontier.empty()) {
+            if (fwd_.frontier.size() <= bwd_.frontier.size()) {
+                expand(graph_, fwd_, bwd_);
+            } else if (in_graph_) {
+                expand(*in_graph_, bwd_, fwd_);
+            } else {
+                expand(graph_, bwd_, fwd_);
+            }
+        }
+
+        return make_path();
+    }
+
+    /**
+     * @brief 最近一次shortest_path()得到的最短路径的跳数
+     *
+     * @return 跳数, 不可达时为-1
+     */
+    int hop_count() const { return best_; }
+
+    /**
+     * @brief 最近一次shortest_path()检查过的边数
+     *
+     * @return 边数
+     */
+    long long edge_checks() const { return edge_checks_; }
+
+private:
+    static void init_side(side &sd, int s, int n)
+    {
+        sd.ws.reset(n);
+        if ((int) sd.dist.size() < n) {
+            sd.dist.resize(n);
+            sd.parent.resize(n);
+        }
+        sd.ws.visit(s);
+        sd.dist[s] = 0;
+        sd.parent[s] = -1;
+        sd.frontier.assign(1, s);
+    }
+
+    /**
+     * @brief 把mine一侧的搜索扩展一层, 遇到other一侧已经探索过的顶点时停止
+     *
+     * 设两侧已经分别探索了a层和b层且尚未相遇, 则最短路径的跳数至少为a+b+1.
+     * 扩展mine一侧时第一次遇到的other一侧的顶点w满足dist_mine(w) = a+1, dist_other(w) <= b,
+     * 经过w的路径长度不超过a+b+1, 因此就是最短路径.
+     *
+     * @param adj mine一侧沿着搜索的邻接关系(正向为原图, 反向为入边视图)
+     * @param mine 被扩展的一侧
+     * @param other 另一侧
+     */
+    template <typename AdjGraph>
+    void expand(const AdjGraph &adj, side &mine, side &other)
+    {
+        mine.next.clear();
+        for (auto v: mine.frontier) {
+            for (auto w: adj.get_adj_list(v)) {
+                edge_checks_++;
+                if (mine.ws.is_visited(w))
+                    continue;
+
+                mine.ws.visit(w);
+                mine.dist[w] = mine.dist[v] + 1;
+                mine.parent[w] = v;
+                mine.next.push_back(w);
+
+                if (other.ws.is_visited(w)) {
+                    // 两侧相遇
+                    best_ = mine.dist[w] + other.dist[w];
+                    meet_ = w;
+                    return;
+                }
+            }
+        }
+        mine.frontier.swap(mine.next);
+    }
+
+    std::vector<int> make_path() const
+    {
+        std::vector<int> path;
+        if (best_ < 0)
+            return path;
+
+        // 从相遇点沿正向搜索树回到起点, 再沿反向搜索树走到终点
+        for (int v = meet_; v != -1; v = fwd_.parent[v])
+            path.push_back(v);
+        std::reverse(path.begin(), path.end());
+        for (int v = bwd_.parent[meet_]; v != -1; v = bwd_.parent[v])
+            path.push_back(v);
+        return path;
+    }
+};
+
+}   // namespace unweight
+
+#endif
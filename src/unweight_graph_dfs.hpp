@@ -9,7 +9,10 @@
 #define UNWEIGHT_GRAPH_DFS_INC
 
 #include <vector>
+#include <memory>
 #include <algorithm>
+#include "unweight_traversal_workspace.hpp"
+#include "unweight_graph_visitor.hpp"
 
 namespace unweight {
 
@@ -17,24 +20,53 @@ namespace unweight {
  * @brief 深度优先搜索(Depth-first Search, DFS)算法，递归版本
  *
  * @tparam Graph 图类型
+ * @tparam Visitor 访问者类型, 参见null_visitor
  */
-template <typename Graph>
+template <typename Graph, typename Visitor = null_visitor>
 class DFS {
 private:
     const Graph &graph_;
-    std::vector<bool> visited_;
+    std::unique_ptr<traversal_workspace> own_ws_;
+    traversal_workspace &ws_;   // 已探索标记
+    Visitor vis_;               // 访问者
 
 public:
-    DFS(const Graph &graph): graph_(graph)
+    DFS(const Graph &graph, Visitor vis = Visitor()):
+        graph_(graph), own_ws_(std::make_unique<traversal_workspace>()), ws_(*own_ws_),
+        vis_(vis)
     {
     }
 
+    /**
+     * @brief 构造一个使用外部工作区的DFS对象
+     *
+     * 反复搜索时, 已探索标记只需O(1)时间重置.
+     *
+     * @param graph 图
+     * @param ws 工作区, 可以与其他搜索对象共享
+     * @param vis 访问者
+     */
+    DFS(const Graph &graph, traversal_workspace &ws, Visitor vis = Visitor()):
+        graph_(graph), ws_(ws), vis_(vis)
+    {
+    }
+
+    /**
+     * @brief 访问者
+     *
+     * @return 搜索使用的访问者
+     */
+    Visitor &visitor() { return vis_; }
+
+    const Visitor &visitor() const { return vis_; }
+
     void search(int s)
     {
         // 把所有顶点标记为未探索
-        visited_.resize(graph_.vertex_count());
-        std::fill(std::begin(visited_), std::end(visited_), false);
+        ws_.reset(graph_.vertex_count());
+        vis_.initialize(graph_.vertex_count());
 
+        vis_.start_vertex(s);
         explore(s);
     }
 
@@ -42,14 +74,18 @@ private:
     void explore(int s)
     {
         // 把s标记为已探索
-        visited_[s] = true;
+        ws_.visit(s);
+        vis_.discover_vertex(s);
 
         // 遍历s的邻接列表
         for (auto v: graph_.get_adj_list(s)) {
-            if (!visited_[v]) {
+            vis_.examine_edge(s, v);
+            if (!ws_.is_visited(v)) {
+                vis_.tree_edge(s, v);
                 explore(v);
             }
         }
+        vis_.finish_vertex(s);
     }
 };
 
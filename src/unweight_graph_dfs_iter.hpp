@@ -9,55 +9,185 @@
 #define UNWEIGHT_GRAPH_DFS_ITER_INC
 
 #include <vector>
-#include <stack>
+#include <memory>
+#include <utility>
+#include <iterator>
 #include <algorithm>
+#include <cstdint>
+#include "unweight_traversal_workspace.hpp"
+#include "unweight_graph_visitor.hpp"
 
 namespace unweight {
 
 /**
  * @brief 深度优先搜索(Depth-first Search, DFS)算法，迭代式版本
  *
+ * 堆栈中的每一帧记录一个顶点和它的邻接列表中下一个要检查的位置, 而不是把所有邻居都压入堆栈:
+ * 每个顶点最多入栈一次, 堆栈的大小为O(V)而不是O(E), 探索顺序与递归版本相同.
+ * 同时记录每个顶点的发现时间和完成时间, 以及前序(pre-order)和后序(post-order)序列.
+ *
  * @tparam Graph 图类型
+ * @tparam Visitor 访问者类型, 参见null_visitor
  */
-template <typename Graph>
+template <typename Graph, typename Visitor = null_visitor>
 class DFS {
 private:
+    using adj_iterator = decltype(std::begin(std::declval<const Graph &>().get_adj_list(0)));
+
+    /**
+     * @brief 堆栈中的一帧: 顶点v和它的邻接列表中尚未检查的部分
+     */
+    struct frame {
+        int v;
+        adj_iterator cur;
+        adj_iterator last;
+    };
+
     const Graph &graph_;
-    std::vector<bool> visited_;
+    std::unique_ptr<traversal_workspace> own_ws_;
+    traversal_workspace &ws_;       // 已探索标记
+    Visitor vis_;                   // 访问者
+    std::vector<frame> stack_;      // 显式的堆栈
+    std::vector<int> d_;            // 每个顶点的发现时间, 只对已探索顶点有效
+    std::vector<int> f_;            // 每个顶点的完成时间, 只对已探索顶点有效
+    std::vector<int> pre_order_;    // 按发现时间排列的顶点
+    std::vector<int> post_order_;   // 按完成时间排列的顶点
+    int time_ = 0;                  // 时钟
+    uint32_t epoch_ = 0;            // 最近一次搜索时工作区的代数
 
 public:
-    DFS(const Graph &graph): graph_(graph)
+    DFS(const Graph &graph, Visitor vis = Visitor()):
+        graph_(graph), own_ws_(std::make_unique<traversal_workspace>()), ws_(*own_ws_),
+        vis_(vis)
+    {
+    }
+
+    /**
+     * @brief 构造一个使用外部工作区的DFS对象
+     *
+     * 反复搜索时, 已探索标记只需O(1)时间重置, 堆栈也不会重新分配.
+     *
+     * @param graph 图
+     * @param ws 工作区, 可以与其他搜索对象共享
+     * @param vis 访问者
+     */
+    DFS(const Graph &graph, traversal_workspace &ws, Visitor vis = Visitor()):
+        graph_(graph), ws_(ws), vis_(vis)
     {
     }
 
+    /**
+     * @brief 访问者
+     *
+     * @return 搜索使用的访问者
+     */
+    Visitor &visitor() { return vis_; }
+
+    const Visitor &visitor() const { return vis_; }
+
     void search(int s)
     {
         // 把所有顶点标记为未探索
-        visited_.resize(graph_.vertex_count());
-        std::fill(std::begin(visited_), std::end(visited_), false);
+        int n = graph_.vertex_count();
+        ws_.reset(n);
+        epoch_ = ws_.epoch();
+        vis_.initialize(n);
+        if ((int) d_.size() < n) {
+            d_.resize(n);
+            f_.resize(n);
+        }
+        pre_order_.clear();
+        post_order_.clear();
+        time_ = 0;
 
         // S := 一个堆栈数据结构，用s初始化
-        std::stack<int> S;
-        S.push(s);
+        stack_.clear();
+        vis_.start_vertex(s);
+        push(s);
 
         // 只要堆栈不为空，就一直处理
-        while (!S.empty()) {
-            // 从S的头部删除("弹出")顶点v
-            auto v = S.top(); S.pop();
-
-            // 如果v为未探索
-            if (!visited_[v]) {
-                // 把v标注为已探索
-                visited_[v] = true;
-
-                // 遍历v的邻接列表
-                for (auto w: graph_.get_adj_list(v)) {
-                    // 把w添加("压入")到S的头部
-                    S.push(w);
+        while (!stack_.empty()) {
+            auto &top = stack_.back();
+            if (top.cur != top.last) {
+                // 检查栈顶顶点的下一条边(v,w)
+                int w = *top.cur;
+                ++top.cur;
+                vis_.examine_edge(top.v, w);
+                if (!ws_.is_visited(w)) {
+                    vis_.tree_edge(top.v, w);
+                    push(w);
                 }
+            } else {
+                // 栈顶顶点的所有边都已检查, 它的探索完成
+                int v = top.v;
+                stack_.pop_back();
+                f_[v] = ++time_;
+                post_order_.push_back(v);
+                vis_.finish_vertex(v);
             }
         }
     }
+
+    /**
+     * @brief 顶点是否可以从最近一次搜索的起点到达
+     *
+     * @param v 顶点
+     *
+     * @return 如果已探索, 返回true, 否则返回false; 共享工作区的其他对象搜索之后总是返回false
+     */
+    bool is_visited(int v) const { return is_current() && ws_.is_visited(v); }
+
+    /**
+     * @brief 顶点的发现时间
+     *
+     * 发现和完成共用一个从1开始的时钟, 对于已探索的顶点v, w:
+     * w是v的后代当且仅当d(v) < d(w) < f(w) < f(v).
+     *
+     * @param v 已探索的顶点
+     *
+     * @return 发现时间, 未探索, 或者共享工作区的其他对象搜索之后为0
+     */
+    int discover_time(int v) const { return is_visited(v) ? d_[v] : 0; }
+
+    /**
+     * @brief 顶点的完成时间
+     *
+     * @param v 已探索的顶点
+     *
+     * @return 完成时间, 未探索, 或者共享工作区的其他对象搜索之后为0
+     */
+    int finish_time(int v) const { return is_visited(v) ? f_[v] : 0; }
+
+    /**
+     * @brief 前序序列
+     *
+     * @return 按发现时间排列的已探索顶点
+     */
+    const std::vector<int> &pre_order() const { return pre_order_; }
+
+    /**
+     * @brief 后序序列
+     *
+     * @return 按完成时间排列的已探索顶点
+     */
+    const std::vector<int> &post_order() const { return post_order_; }
+
+private:
+    /**
+     * @brief 工作区中的标记是否仍然属于本对象最近一次的搜索
+     */
+    bool is_current() const { return epoch_ != 0 && ws_.epoch() == epoch_; }
+
+    void push(int v)
+    {
+        // 把v标注为已探索
+        ws_.visit(v);
+        d_[v] = ++time_;
+        pre_order_.push_back(v);
+        vis_.discover_vertex(v);
+        auto &&adj = graph_.get_adj_list(v);
+        stack_.push_back(frame{v, std::begin(adj), std::end(adj)});
+    }
 };
 
 }   // namespace unweight
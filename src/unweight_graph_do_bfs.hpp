@@ -0,0 +1,255 @@
+/**
+ * @file unweight_graph_do_bfs.hpp
+ * @brief 方向优化的宽度优先搜索(Direction-optimizing BFS)算法
+ * @author hexu_1985@sina.com
+ * @version 1.0
+ * @date 2020-09-14
+ *
+ * @see Beamer, Asanovic, Patterson: Direction-optimizing breadth-first search (2012)
+ */
+#ifndef UNWEIGHT_GRAPH_DO_BFS_INC
+#define UNWEIGHT_GRAPH_DO_BFS_INC
+
+#include <vector>
+#include <memory>
+#include <cstdint>
+#include <algorithm>
+#include <type_traits>
+#include "bit_utils.hpp"
+#include "unweight_csr_graph.hpp"
+#include "unweight_traversal_workspace.hpp"
+
+namespace unweight {
+
+/**
+ * @brief 方向优化的宽度优先搜索算法
+ *
+ * 按层进行搜索. 当前层较小时自顶向下: 遍历当前层顶点的邻接列表, 寻找未探索的顶点;
+ * 当前层很大时自底向上: 对每个未探索的顶点, 遍历它的入边, 只要找到一个位于
+ * 当前层的顶点就停止, 从而跳过大量不会产生新顶点的边.
+ * 有向图的自底向上需要入边视图, 通过csr_graph::make_reverse()创建.
+ * 度数和入边视图在构造时创建一次, 图被修改之后需要调用refresh().
+ *
+ * @tparam Graph 图类型
+ */
+template <typename Graph>
+class DirectionOptimizingBFS {
+private:
+    const Graph &graph_;
+    std::unique_ptr<traversal_workspace> own_ws_;
+    traversal_workspace &ws_;               // 已探索标记
+    double alpha_ = 14;                     // 自顶向下切换到自底向上的阈值
+    double beta_ = 24;                      // 自底向上切换回自顶向下的阈值
+    std::vector<int> degree_;               // 每个顶点的(出)度数, Graph为csr_graph时不使用
+    long long total_degree_ = 0;            // 所有顶点的度数之和
+    int v_cnt_ = -1;                        // refresh()时图的顶点数
+    int e_cnt_ = -1;                        // refresh()时图的边数
+    std::unique_ptr<csr_graph> in_graph_;   // 有向图的入边视图, 自底向上时使用
+    long long edge_checks_ = 0;             // 检查过的边数
+    uint32_t epoch_ = 0;                    // 最近一次搜索时工作区的代数
+
+public:
+    DirectionOptimizingBFS(const Graph &graph):
+        graph_(graph), own_ws_(std::make_unique<traversal_workspace>()), ws_(*own_ws_)
+    {
+        refresh();
+    }
+
+    /**
+     * @brief 构造一个使用外部工作区的对象
+     *
+     * @param graph 图
+     * @param ws 工作区, 可以与其他搜索对象共享
+     */
+    DirectionOptimizingBFS(const Graph &graph, traversal_workspace &ws): graph_(graph), ws_(ws)
+    {
+        refresh();
+    }
+
+    /**
+     * @brief 重新计算每个顶点的度数, 有向图还要重新创建入边视图
+     *
+     * 搜索时如果图的顶点数或边数发生了变化会自动调用refresh(),
+     * 但删除和插入的边数相同时无法发现, 这时修改图之后需要手动调用.
+     */
+    void refresh()
+    {
+        int n = graph_.vertex_count();
+        v_cnt_ = n;
+        e_cnt_ = graph_.edge_count();
+        total_degree_ = 0;
+        if constexpr (std::is_same<Graph, csr_graph>::value) {
+            for (int v = 0; v < n; v++)
+                total_degree_ += graph_.degree(v);
+        } else {
+            degree_.assign(n, 0);
+            for (int v = 0; v < n; v++) {
+                for (auto w: graph_.get_adj_list(v)) {
+                    (void) w;
+                    degree_[v]++;
+                }
+                total_degree_ += degree_[v];
+            }
+        }
+
+        if (graph_.is_directed())
+            in_graph_ = std::make_unique<csr_graph>(csr_graph::make_reverse(graph_));
+        else
+            in_graph_.reset();
+    }
+
+    /**
+     * @brief 设置方向优化搜索的切换阈值
+     *
+     * 设m_f为当前层所有顶点的度数之和, m_u为所有未探索顶点的度数之和,
+     * n_f为当前层的顶点数, n为顶点总数:
+     * 当m_f > m_u / alpha时从自顶向下切换到自底向上,
+     * 当n_f < n / beta时从自底向上切换回自顶向下.
+     *
+     * @param alpha 自顶向下切换到自底向上的阈值
+     * @param beta 自底向上切换回自顶向下的阈值
+     */
+    void set_direction_params(double alpha, double beta)
+    {
+        alpha_ = alpha;
+        beta_ = beta;
+    }
+
+    /**
+     * @brief 方向优化的宽度优先搜索, 探索到的顶点与BFS::search()相同
+     *
+     * @param s 起点
+     */
+    void search(int s)
+    {
+        int n = graph_.vertex_count();
+        if (n != v_cnt_ || graph_.edge_count() != e_cnt_)
+            refresh();
+
+        // 把s标记为已探索，所有其他顶点标记为未探索
+        ws_.reset(n);
+        epoch_ = ws_.epoch();
+        ws_.visit(s);
+        edge_checks_ = 0;
+
+        std::vector<int> frontier = {s};        // 当前层(列表形式)
+        std::vector<int> next;
+        std::vector<uint64_t> frontier_bits(bits::word_count(n), 0);    // 当前层(位图形式)
+        std::vector<uint64_t> next_bits(bits::word_count(n), 0);
+
+        long long m_f = degree(s);              // 当前层的度数之和
+        long long m_u = total_degree_ - m_f;    // 未探索顶点的度数之和
+        long long n_f = 1;                      // 当前层的顶点数
+        bool bottom_up = false;
+
+        while (n_f > 0) {
+            // 根据当前层的规模选择搜索方向, 并在两种表示之间转换当前层
+            if (!bottom_up && m_f > m_u / alpha_) {
+                bottom_up = true;
+                std::fill(frontier_bits.begin(), frontier_bits.end(), 0);
+                for (auto v: frontier)
+                    frontier_bits[v / bits::word_bits] |= uint64_t(1) << (v % bits::word_bits);
+            } else if (bottom_up && n_f < n / beta_) {
+                bottom_up = false;
+                frontier.clear();
+                for (int i = 0; i < (int) frontier_bits.size(); i++) {
+                    for (uint64_t word = frontier_bits[i]; word; word &= word - 1)
+                        frontier.push_back(i * bits::word_bits + bits::count_trailing_zeros(word));
+                }
+            }
+
+            long long n_next = 0;
+            long long m_next = 0;
+            if (bottom_up) {
+                // 无向图的入边就是邻接列表本身
+                if (in_graph_)
+                    bottom_up_step(*in_graph_, frontier_bits, next_bits, n_next, m_next);
+                else
+                    bottom_up_step(graph_, frontier_bits, next_bits, n_next, m_next);
+                frontier_bits.swap(next_bits);
+            } else {
+                top_down_step(frontier, next, n_next, m_next);
+                frontier.swap(next);
+            }
+
+            m_u -= m_next;
+            m_f = m_next;
+            n_f = n_next;
+        }
+    }
+
+    /**
+     * @brief 最近一次搜索检查过的边数
+     *
+     * @return 边数
+     */
+    long long edge_checks() const { return edge_checks_; }
+
+    /**
+     * @brief 顶点是否在最近一次搜索中被探索到(从起点可达)
+     *
+     * @param v 顶点
+     *
+     * @return 如果v可达, 返回true, 否则返回false; 共享工作区的其他对象搜索之后总是返回false
+     */
+    bool is_visited(int v) const { return epoch_ != 0 && ws_.epoch() == epoch_ && ws_.is_visited(v); }
+
+private:
+    int degree(int v) const
+    {
+        if constexpr (std::is_same<Graph, csr_graph>::value)
+            return graph_.degree(v);
+        else
+            return degree_[v];
+    }
+
+    /**
+     * @brief 自顶向下的一步: 从当前层顶点出发, 探索它们的未探索邻接顶点
+     */
+    void top_down_step(const std::vector<int> &frontier, std::vector<int> &next,
+            long long &n_next, long long &m_next)
+    {
+        next.clear();
+        for (auto v: frontier) {
+            for (auto w: graph_.get_adj_list(v)) {
+                edge_checks_++;
+                if (!ws_.is_visited(w)) {
+                    ws_.visit(w);
+                    next.push_back(w);
+                    m_next += degree(w);
+                }
+            }
+        }
+        n_next = next.size();
+    }
+
+    /**
+     * @brief 自底向上的一步: 每个未探索顶点在入边中寻找一个位于当前层的顶点
+     *
+     * @param in_graph 入边视图, in_graph.get_adj_list(v)为v的所有入边的起点
+     */
+    template <typename InGraph>
+    void bottom_up_step(const InGraph &in_graph, const std::vector<uint64_t> &frontier_bits,
+            std::vector<uint64_t> &next_bits, long long &n_next, long long &m_next)
+    {
+        std::fill(next_bits.begin(), next_bits.end(), 0);
+        for (int v = 0; v < graph_.vertex_count(); v++) {
+            if (ws_.is_visited(v)) continue;
+            for (auto u: in_graph.get_adj_list(v)) {
+                edge_checks_++;
+                if ((frontier_bits[u / bits::word_bits] >> (u % bits::word_bits)) & 1) {
+                    // v的某个入边起点位于当前层, v属于下一层
+                    ws_.visit(v);
+                    next_bits[v / bits::word_bits] |= uint64_t(1) << (v % bits::word_bits);
+                    n_next++;
+                    m_next += degree(v);
+                    break;
+                }
+            }
+        }
+    }
+};
+
+}   // namespace unweight
+
+#endif
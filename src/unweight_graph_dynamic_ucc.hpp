@@ -0,0 +1,520 @@
+/**
+ * @file unweight_graph_dynamic_ucc.hpp
+ * @brief 支持插入和删除边的全动态无向图连通分量(Dynamic Undigraph Connected Components)
+ * @author hexu_1985@sina.com
+ * @version 1.0
+ * @date 2020-09-28
+ *
+ * @see Holm, de Lichtenberg, Thorup: Poly-logarithmic deterministic fully-dynamic algorithms
+ *      for connectivity, minimum spanning tree, 2-edge, and biconnectivity (2001)
+ */
+#ifndef UNWEIGHT_GRAPH_DYNAMIC_UCC_INC
+#define UNWEIGHT_GRAPH_DYNAMIC_UCC_INC
+
+#include <vector>
+#include <memory>
+#include <random>
+#include <cstdint>
+#include <utility>
+#include <algorithm>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace unweight {
+
+namespace detail {
+
+/**
+ * @brief 用欧拉回路(Euler tour)表示的森林
+ *
+ * 每棵树表示为一个循环序列: 每个顶点出现一次(顶点节点), 每条树边(u,v)以u->v和v->u
+ * 两个方向各出现一次(弧节点). 序列保存在以位置为键的treap中, 连接(link)和
+ * 断开(cut)一条边都可以通过O(log V)次分裂(split)和合并(merge)完成.
+ *
+ * 每个顶点节点可以带有若干标记位, treap的每个节点汇总子树中所有标记位的或,
+ * 从而可以在O(log V)时间内找到一棵树中带有某个标记的顶点.
+ */
+class euler_tour_forest {
+private:
+    struct node {
+        int left = -1;
+        int right = -1;
+        int parent = -1;
+        uint32_t priority = 0;
+        int size = 1;           // 子树中的节点个数
+        int vertexes = 0;       // 子树中的顶点节点个数
+        uint8_t flags = 0;      // 本节点的标记(只有顶点节点有)
+        uint8_t sub_flags = 0;  // 子树中所有标记的或
+    };
+
+    int v_cnt_;
+    std::vector<node> nodes_;                   // 前v_cnt_个是顶点节点, 之后是弧节点
+    std::vector<int> free_;                     // 可以重复使用的弧节点
+    std::unordered_map<long long, int> arcs_;   // 弧(u,v) -> 弧节点
+    std::mt19937 rand_;
+
+public:
+    explicit euler_tour_forest(int v_cnt): v_cnt_(v_cnt), nodes_(v_cnt), rand_(v_cnt)
+    {
+        for (int v = 0; v < v_cnt_; v++) {
+            nodes_[v].priority = rand_();
+            nodes_[v].vertexes = 1;
+        }
+    }
+
+    /**
+     * @brief u和v是否在同一棵树中
+     */
+    bool connected(int u, int v) const { return root(u) == root(v); }
+
+    /**
+     * @brief v所在的树的顶点个数
+     */
+    int tree_size(int v) const { return nodes_[root(v)].vertexes; }
+
+    /**
+     * @brief 添加树边(u,v), u和v必须在不同的树中
+     */
+    void link(int u, int v)
+    {
+        int tu = reroot(u);
+        int tv = reroot(v);
+        int uv = new_arc(u, v);
+        int vu = new_arc(v, u);
+        detach(merge(merge(merge(tu, uv), tv), vu));
+    }
+
+    /**
+     * @brief 删除树边(u,v), 一棵树分裂成两棵
+     */
+    void cut(int u, int v)
+    {
+        int a = arcs_[key(u, v)];
+        int b = arcs_[key(v, u)];
+        int pa = index(a);
+        int pb = index(b);
+        if (pa > pb) {
+            std::swap(a, b);
+            std::swap(pa, pb);
+        }
+
+        // 序列为 A a B b C, 其中B是一棵树, C A是另一棵树
+        int left, mid, right, tmp;
+        split(root(a), pa, left, tmp);
+        split(tmp, 1, mid, tmp);
+        split(tmp, pb - pa - 1, mid, right);
+        split(right, 1, tmp, right);
+        detach(mid);
+        detach(merge(left, right));
+
+        free_arc(u, v);
+        free_arc(v, u);
+    }
+
+    /**
+     * @brief 设置或清除顶点v的标记位
+     */
+    void set_flag(int v, uint8_t flag, bool on)
+    {
+        uint8_t flags = on ? (nodes_[v].flags | flag) : (nodes_[v].flags & ~flag);
+        if (flags == nodes_[v].flags)
+            return;
+        nodes_[v].flags = flags;
+        for (int x = v; x != -1; x = nodes_[x].parent)
+            update(x);
+    }
+
+    /**
+     * @brief 在v所在的树中找一个带有标记位flag的顶点
+     *
+     * @return 顶点, 没有时返回-1
+     */
+    int find_flagged(int v, uint8_t flag) const
+    {
+        int x = root(v);
+        if (!(nodes_[x].sub_flags & flag))
+            return -1;
+        for (;;) {
+            if (nodes_[x].flags & flag)
+                return x;
+            int l = nodes_[x].left;
+            x = (l != -1 && (nodes_[l].sub_flags & flag)) ? l : nodes_[x].right;
+        }
+    }
+
+private:
+    long long key(int u, int v) const { return (long long) u * v_cnt_ + v; }
+
+    int size(int x) const { return x == -1 ? 0 : nodes_[x].size; }
+
+    int root(int x) const
+    {
+        while (nodes_[x].parent != -1)
+            x = nodes_[x].parent;
+        return x;
+    }
+
+    void detach(int x)
+    {
+        if (x != -1)
+            nodes_[x].parent = -1;
+    }
+
+    /**
+     * @brief 节点x在序列中的位置
+     */
+    int index(int x) const
+    {
+        int pos = size(nodes_[x].left);
+        for (int p = nodes_[x].parent; p != -1; x = p, p = nodes_[p].parent) {
+            if (nodes_[p].right == x)
+                pos += size(nodes_[p].left) + 1;
+        }
+        return pos;
+    }
+
+    /**
+     * @brief 根据子节点重新计算x的汇总信息, 并设置子节点的父指针
+     */
+    void update(int x)
+    {
+        node &n = nodes_[x];
+        n.size = 1;
+        n.vertexes = x < v_cnt_ ? 1 : 0;
+        n.sub_flags = n.flags;
+        for (int c: {n.left, n.right}) {
+            if (c == -1) continue;
+            nodes_[c].parent = x;
+            n.size += nodes_[c].size;
+            n.vertexes += nodes_[c].vertexes;
+            n.sub_flags |= nodes_[c].sub_flags;
+        }
+    }
+
+    int merge(int a, int b)
+    {
+        if (a == -1) return b;
+        if (b == -1) return a;
+        if (nodes_[a].priority > nodes_[b].priority) {
+            nodes_[a].right = merge(nodes_[a].right, b);
+            update(a);
+            return a;
+        } else {
+            nodes_[b].left = merge(a, nodes_[b].left);
+            update(b);
+            return b;
+        }
+    }
+
+    /**
+     * @brief 把t分成前k个节点l和其余的节点r
+     */
+    void split(int t, int k, int &l, int &r)
+    {
+        if (t == -1) {
+            l = r = -1;
+            return;
+        }
+        if (size(nodes_[t].left) >= k) {
+            split(nodes_[t].left, k, l, nodes_[t].left);
+            update(t);
+            r = t;
+        } else {
+            split(nodes_[t].right, k - size(nodes_[t].left) - 1, nodes_[t].right, r);
+            update(t);
+            l = t;
+        }
+        detach(l);
+        detach(r);
+    }
+
+    /**
+     * @brief 旋转v所在的循环序列, 使v的顶点节点位于开头
+     *
+     * @return 新的treap的根
+     */
+    int reroot(int v)
+    {
+        int left, right;
+        split(root(v), index(v), left, right);
+        int t = merge(right, left);
+        detach(t);
+        return t;
+    }
+
+    int new_arc(int u, int v)
+    {
+        int x;
+        if (free_.empty()) {
+            x = static_cast<int>(nodes_.size());
+            nodes_.emplace_back();
+        } else {
+            x = free_.back();
+            free_.pop_back();
+            nodes_[x] = node();
+        }
+        nodes_[x].priority = rand_();
+        arcs_[key(u, v)] = x;
+        return x;
+    }
+
+    void free_arc(int u, int v)
+    {
+        auto it = arcs_.find(key(u, v));
+        free_.push_back(it->second);
+        arcs_.erase(it);
+    }
+};
+
+}   // namespace detail
+
+/**
+ * @brief 支持插入和删除边的全动态无向图连通分量(Holm-de Lichtenberg-Thorup算法)
+ *
+ * 每条边有一个层数(level), 层数只增不减且不超过log2(V). 第i层的森林F_i由层数不小于i的
+ * 生成树边组成, F_0就是整个图的生成森林, 用欧拉回路森林表示.
+ * 删除一条树边后, 在较小的一侧从高层到低层寻找替代边; 检查过但不能作为替代边的
+ * 非树边提升到更高的层, 每条边最多被提升log2(V)次, 因此更新的均摊时间复杂度为O(log^2 V),
+ * 查询的时间复杂度为O(log V).
+ *
+ * 通过DynamicUCC::insert()和DynamicUCC::remove()修改图, 与图的接口一致:
+ * 平行边可以多次插入, remove()删除两个顶点之间的所有平行边.
+ *
+ * @tparam Graph 图类型, 需要提供insert(edge_type)和remove(edge_type)
+ */
+template <typename Graph>
+class DynamicUCC {
+public:
+    using edge_type = typename Graph::edge_type;
+
+private:
+    /**
+     * @brief 两个顶点之间的边(包括所有平行边)
+     */
+    struct edge_info {
+        int level = 0;          // 层数
+        int count = 0;          // 平行边的条数
+        bool tree = false;      // 是否为生成森林中的边
+    };
+
+    static constexpr uint8_t nontree_flag = 1;  // 顶点在这一层有非树边
+    static constexpr uint8_t tree_flag = 2;     // 顶点在这一层有层数恰好为这一层的树边
+
+    Graph &graph_;
+    int v_cnt_;
+    int num_cc_;                                                // 连通分量的个数
+    std::vector<std::unique_ptr<detail::euler_tour_forest>> forests_;  // 每一层的森林F_i
+    std::unordered_map<long long, edge_info> edges_;            // (min(u,v), max(u,v)) -> 边
+    std::vector<std::vector<std::unordered_set<int>>> nontree_; // 每个顶点在每一层的非树边
+    std::vector<std::vector<std::unordered_set<int>>> tree_;    // 每个顶点在每一层的树边
+
+public:
+    /**
+     * @brief 构造对象, 根据图中已有的边建立生成森林
+     *
+     * @param graph 无向图, 之后应该通过insert()和remove()修改
+     */
+    DynamicUCC(Graph &graph):
+        graph_(graph), v_cnt_(graph.vertex_count()), num_cc_(graph.vertex_count()),
+        nontree_(graph.vertex_count()), tree_(graph.vertex_count())
+    {
+        forest(0);
+        for (int v = 0; v < v_cnt_; v++) {
+            for (auto w: graph_.get_adj_list(v)) {
+                // 每条边在两个端点的邻接列表中各出现一次
+                if (v < w)
+                    add_edge(v, w);
+            }
+        }
+    }
+
+    /**
+     * @brief 向图中插入一条边
+     *
+     * @param e 要插入的边
+     */
+    void insert(edge_type e)
+    {
+        graph_.insert(e);
+        auto [u, v] = e;
+        if (u != v)
+            add_edge(u, v);
+    }
+
+    /**
+     * @brief 从图中删除一条边(包括所有平行边)
+     *
+     * @param e 要删除的边
+     */
+    void remove(edge_type e)
+    {
+        graph_.remove(e);
+        auto [u, v] = e;
+        if (u == v)
+            return;
+
+        auto it = edges_.find(key(u, v));
+        if (it == edges_.end())
+            return;
+        edge_info info = it->second;
+        edges_.erase(it);
+
+        int level = info.level;
+        if (!info.tree) {
+            erase_adj(nontree_, nontree_flag, u, v, level);
+            return;
+        }
+
+        // 从所有包含它的森林中删除这条树边
+        erase_adj(tree_, tree_flag, u, v, level);
+        for (int i = 0; i <= level; i++)
+            forests_[i]->cut(u, v);
+
+        // 从高层到低层寻找替代边
+        for (int i = level; i >= 0; i--) {
+            if (replace(u, v, i))
+                return;
+        }
+        num_cc_++;
+    }
+
+    /**
+     * @brief 两个顶点是否连通
+     *
+     * @param u 顶点
+     * @param v 顶点
+     *
+     * @return 如果连通, 返回true, 否则返回false
+     */
+    bool connected(int u, int v) const { return forests_[0]->connected(u, v); }
+
+    /**
+     * @brief 顶点所在的连通分量的顶点个数
+     *
+     * @param v 顶点
+     *
+     * @return 顶点个数
+     */
+    int component_size(int v) const { return forests_[0]->tree_size(v); }
+
+    /**
+     * @brief 连通分量的个数
+     *
+     * @return 个数
+     */
+    int count() const { return num_cc_; }
+
+    /**
+     * @brief 图
+     *
+     * @return 维护连通分量的图
+     */
+    const Graph &graph() const { return graph_; }
+
+private:
+    long long key(int u, int v) const
+    {
+        return (long long) std::min(u, v) * v_cnt_ + std::max(u, v);
+    }
+
+    detail::euler_tour_forest &forest(int level)
+    {
+        while ((int) forests_.size() <= level)
+            forests_.push_back(std::make_unique<detail::euler_tour_forest>(v_cnt_));
+        return *forests_[level];
+    }
+
+    void add_edge(int u, int v)
+    {
+        auto &info = edges_[key(u, v)];
+        if (info.count++ > 0)
+            return;
+
+        if (forests_[0]->connected(u, v)) {
+            insert_adj(nontree_, nontree_flag, u, v, 0);
+        } else {
+            info.tree = true;
+            insert_adj(tree_, tree_flag, u, v, 0);
+            forests_[0]->link(u, v);
+            num_cc_--;
+        }
+    }
+
+    /**
+     * @brief 把边(u,v)加入两个端点在第level层的邻接集合, 并更新标记
+     */
+    void insert_adj(std::vector<std::vector<std::unordered_set<int>>> &adj, uint8_t flag,
+            int u, int v, int level)
+    {
+        for (auto [x, y]: {std::make_pair(u, v), std::make_pair(v, u)}) {
+            if ((int) adj[x].size() <= level)
+                adj[x].resize(level+1);
+            adj[x][level].insert(y);
+            forest(level).set_flag(x, flag, true);
+        }
+    }
+
+    /**
+     * @brief 把边(u,v)从两个端点在第level层的邻接集合中删除, 并更新标记
+     */
+    void erase_adj(std::vector<std::vector<std::unordered_set<int>>> &adj, uint8_t flag,
+            int u, int v, int level)
+    {
+        for (auto [x, y]: {std::make_pair(u, v), std::make_pair(v, u)}) {
+            adj[x][level].erase(y);
+            forests_[level]->set_flag(x, flag, !adj[x][level].empty());
+        }
+    }
+
+    /**
+     * @brief 删除第level层的树边(u,v)之后, 在第level层寻找替代边
+     *
+     * 设T为F_level中u和v所在的两棵树中较小的一棵, 它的顶点数不超过V/2^(level+1):
+     * 先把T中层数为level的树边提升到level+1层, 再检查T中顶点在第level层的非树边,
+     * 另一端不在T中的就是替代边, 另一端也在T中的提升到level+1层.
+     *
+     * @return 找到替代边时返回true, 否则返回false
+     */
+    bool replace(int u, int v, int level)
+    {
+        auto &f = *forests_[level];
+        if (f.tree_size(u) > f.tree_size(v))
+            std::swap(u, v);
+
+        // 把T中层数为level的树边提升一层
+        for (int x = f.find_flagged(u, tree_flag); x != -1; x = f.find_flagged(u, tree_flag)) {
+            std::vector<int> ys(tree_[x][level].begin(), tree_[x][level].end());
+            for (auto y: ys) {
+                erase_adj(tree_, tree_flag, x, y, level);
+                insert_adj(tree_, tree_flag, x, y, level+1);
+                forest(level+1).link(x, y);
+                edges_[key(x, y)].level = level+1;
+            }
+        }
+
+        // 检查T中的非树边
+        for (int x = f.find_flagged(u, nontree_flag); x != -1; x = f.find_flagged(u, nontree_flag)) {
+            while (!nontree_[x][level].empty()) {
+                int y = *nontree_[x][level].begin();
+                erase_adj(nontree_, nontree_flag, x, y, level);
+                auto &info = edges_[key(x, y)];
+                if (!f.connected(x, y)) {
+                    // 找到替代边, 把它加入F_0到F_level
+                    info.tree = true;
+                    insert_adj(tree_, tree_flag, x, y, level);
+                    for (int i = 0; i <= level; i++)
+                        forests_[i]->link(x, y);
+                    return true;
+                }
+                info.level = level+1;
+                insert_adj(nontree_, nontree_flag, x, y, level+1);
+            }
+        }
+
+        return false;
+    }
+};
+
+}   // namespace unweight
+
+#endif
@@ -0,0 +1,136 @@
+/**
+ * @file unweight_graph_incremental_ucc.hpp
+ * @brief 插入边时增量维护的无向图连通分量(Incremental Undigraph Connected Components)
+ * @author hexu_1985@sina.com
+ * @version 1.0
+ * @date 2020-09-26
+ */
+#ifndef UNWEIGHT_GRAPH_INCREMENTAL_UCC_INC
+#define UNWEIGHT_GRAPH_INCREMENTAL_UCC_INC
+
+#include <vector>
+#include <utility>
+
+namespace unweight {
+
+/**
+ * @brief 插入边时增量维护的无向图连通分量
+ *
+ * 通过IncrementalUCC::insert()向图中插入边, 同时用并查集(按秩合并和路径压缩)
+ * 合并两个端点所在的连通分量, 不需要重新遍历整个图.
+ * 每次插入和查询的均摊时间复杂度为O(α(V)), α为阿克曼函数的反函数, 实际上可以看作常数.
+ *
+ * @tparam Graph 图类型, 需要提供insert(edge_type)
+ */
+template <typename Graph>
+class IncrementalUCC {
+public:
+    using edge_type = typename Graph::edge_type;
+
+private:
+    Graph &graph_;
+    mutable std::vector<int> parent_;   // 并查集中的父顶点, 查询时也会压缩路径
+    std::vector<int> rank_;             // 以每个顶点为根的树的高度上界
+    int num_cc_ = 0;                    // 连通分量的个数
+
+public:
+    /**
+     * @brief 构造对象, 根据图中已有的边计算连通分量
+     *
+     * @param graph 无向图, 之后应该通过insert()插入边
+     */
+    IncrementalUCC(Graph &graph):
+        graph_(graph), parent_(graph.vertex_count()), rank_(graph.vertex_count(), 0),
+        num_cc_(graph.vertex_count())
+    {
+        for (int v = 0; v < graph_.vertex_count(); v++)
+            parent_[v] = v;
+
+        for (int v = 0; v < graph_.vertex_count(); v++) {
+            for (auto w: graph_.get_adj_list(v))
+                unite(v, w);
+        }
+    }
+
+    /**
+     * @brief 向图中插入一条边, 并合并两个端点所在的连通分量
+     *
+     * @param e 要插入的边
+     */
+    void insert(edge_type e)
+    {
+        graph_.insert(e);
+        auto [u, v] = e;
+        unite(u, v);
+    }
+
+    /**
+     * @brief 两个顶点是否连通
+     *
+     * @param u 顶点
+     * @param v 顶点
+     *
+     * @return 如果连通, 返回true, 否则返回false
+     */
+    bool connected(int u, int v) const { return find(u) == find(v); }
+
+    /**
+     * @brief 顶点所在的连通分量
+     *
+     * 用连通分量的代表顶点作为编号. 两个连通分量合并后, 其中一个的编号会改变.
+     *
+     * @param v 顶点
+     *
+     * @return 连通分量的代表顶点
+     */
+    int component_of(int v) const { return find(v); }
+
+    /**
+     * @brief 连通分量的个数
+     *
+     * @return 个数
+     */
+    int count() const { return num_cc_; }
+
+    /**
+     * @brief 图
+     *
+     * @return 维护连通分量的图
+     */
+    const Graph &graph() const { return graph_; }
+
+private:
+    /**
+     * @brief 查找v所在的树的根, 同时把路径上的每个顶点指向它的祖父顶点(路径减半)
+     */
+    int find(int v) const
+    {
+        while (parent_[v] != v) {
+            parent_[v] = parent_[parent_[v]];
+            v = parent_[v];
+        }
+        return v;
+    }
+
+    /**
+     * @brief 合并u和v所在的树: 把较矮的树挂到较高的树的根下面
+     */
+    void unite(int u, int v)
+    {
+        int ru = find(u);
+        int rv = find(v);
+        if (ru == rv)
+            return;
+
+        if (rank_[ru] < rank_[rv])
+            std::swap(ru, rv);
+        parent_[rv] = ru;
+        if (rank_[ru] == rank_[rv])
+            rank_[ru]++;
+        num_cc_--;
+    }
+};
+
+}   // namespace unweight
+
+#endif
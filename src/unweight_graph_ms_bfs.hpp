@@ -0,0 +1,198 @@
+/**
+ * @file unweight_graph_ms_bfs.hpp
+ * @brief 位并行的多源宽度优先搜索(Multi-Source BFS, MS-BFS)算法
+ * @author hexu_1985@sina.com
+ * @version 1.0
+ * @date 2020-09-20
+ */
+#ifndef UNWEIGHT_GRAPH_MS_BFS_INC
+#define UNWEIGHT_GRAPH_MS_BFS_INC
+
+#include <array>
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+#include "bit_utils.hpp"
+
+namespace unweight {
+
+/**
+ * @brief 位并行的多源宽度优先搜索算法
+ *
+ * 同时从最多64*Words个起点进行BFS. 每个顶点用一个位集合记录哪些起点的搜索已经到达它,
+ * 沿一条边扩展时一次处理整个位集合, 多个搜索共享同一次邻接列表扫描.
+ * Words大于1时位集合运算是对定长数组的循环, 编译器可以把它向量化为SIMD指令.
+ *
+ * @tparam Graph 图类型
+ * @tparam Words 每个位集合的字数, 起点个数最多为64*Words
+ */
+template <typename Graph, int Words = 1>
+class MultiSourceBFS {
+public:
+    /**
+     * @brief 起点集合, 第i位表示第i个起点
+     */
+    using source_set = std::array<uint64_t, Words>;
+
+    /**
+     * @brief 一次搜索最多支持的起点个数
+     */
+    static constexpr int max_sources = Words * bits::word_bits;
+
+private:
+    const Graph &graph_;
+    std::vector<source_set> seen_;          // 每个顶点已经被哪些起点的搜索到达
+    std::vector<source_set> visit_;         // 每个顶点在当前层被哪些起点的搜索到达
+    std::vector<source_set> visit_next_;    // 每个顶点在下一层被哪些起点的搜索到达
+    std::vector<int> frontier_;             // 当前层的顶点
+    std::vector<int> next_;                 // 下一层的候选顶点
+    std::vector<int> reached_count_;        // 每个起点可以到达的顶点数(包括起点自己)
+    std::vector<long long> distance_sum_;   // 每个起点到所有可达顶点的跳数之和
+
+    static bool any(const source_set &a)
+    {
+        uint64_t x = 0;
+        for (int i = 0; i < Words; i++)
+            x |= a[i];
+        return x != 0;
+    }
+
+public:
+    MultiSourceBFS(const Graph &graph): graph_(graph)
+    {
+    }
+
+    /**
+     * @brief 同时从多个起点进行BFS
+     *
+     * @param sources 起点列表, 最多max_sources个
+     *
+     * @return 起点个数超过max_sources时返回false, 否则返回true
+     */
+    bool search(const std::vector<int> &sources)
+    {
+        return search(sources, [](int, int, const source_set &) {});
+    }
+
+    /**
+     * @brief 同时从多个起点进行BFS, 每当一个顶点第一次被一些起点的搜索到达时调用visit
+     *
+     * @param sources 起点列表, 最多max_sources个
+     * @param visit 回调函数visit(v, level, mask): mask中的起点在第level层到达顶点v
+     *
+     * @return 起点个数超过max_sources时返回false, 否则返回true
+     */
+    template <typename Visitor>
+    bool search(const std::vector<int> &sources, Visitor visit)
+    {
+        int k = static_cast<int>(sources.size());
+        if (k > max_sources)
+            return false;
+
+        int n = graph_.vertex_count();
+        seen_.assign(n, source_set{});
+        visit_.assign(n, source_set{});
+        visit_next_.assign(n, source_set{});
+        reached_count_.assign(k, 0);
+        distance_sum_.assign(k, 0);
+
+        // 第i个起点的搜索从sources[i]开始
+        frontier_.clear();
+        for (int i = 0; i < k; i++) {
+            int s = sources[i];
+            if (!any(visit_[s]))
+                frontier_.push_back(s);
+            seen_[s][i / bits::word_bits] |= uint64_t(1) << (i % bits::word_bits);
+            visit_[s][i / bits::word_bits] |= uint64_t(1) << (i % bits::word_bits);
+        }
+        for (auto s: frontier_)
+            report(s, 0, visit_[s], visit);
+
+        for (int level = 1; !frontier_.empty(); level++) {
+            // 把当前层的位集合沿着每条边传给邻接顶点
+            next_.clear();
+            for (auto v: frontier_) {
+                const source_set &bits_v = visit_[v];
+                for (auto w: graph_.get_adj_list(v)) {
+                    auto &next_w = visit_next_[w];
+                    if (!any(next_w))
+                        next_.push_back(w);
+                    for (int i = 0; i < Words; i++)
+                        next_w[i] |= bits_v[i];
+                }
+            }
+
+            // 清空当前层
+            for (auto v: frontier_)
+                visit_[v] = source_set{};
+
+            // 去掉已经到达过的起点, 剩下的就是第一次到达的起点
+            frontier_.clear();
+            for (auto w: next_) {
+                auto &next_w = visit_next_[w];
+                auto &seen_w = seen_[w];
+                for (int i = 0; i < Words; i++) {
+                    next_w[i] &= ~seen_w[i];
+                    seen_w[i] |= next_w[i];
+                }
+                if (any(next_w)) {
+                    visit_[w] = next_w;
+                    frontier_.push_back(w);
+                    report(w, level, next_w, visit);
+                }
+                next_w = source_set{};
+            }
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief 第i个起点可以到达的顶点数(包括起点自己)
+     *
+     * @param i 起点在起点列表中的位置
+     *
+     * @return 顶点数
+     */
+    int reached_count(int i) const { return reached_count_[i]; }
+
+    /**
+     * @brief 第i个起点到所有可达顶点的跳数之和, 可以用来计算接近中心性(closeness centrality)
+     *
+     * @param i 起点在起点列表中的位置
+     *
+     * @return 跳数之和
+     */
+    long long distance_sum(int i) const { return distance_sum_[i]; }
+
+    /**
+     * @brief 第i个起点是否可以到达顶点v
+     *
+     * @param i 起点在起点列表中的位置
+     * @param v 顶点
+     *
+     * @return 如果可达, 返回true, 否则返回false
+     */
+    bool is_reached(int i, int v) const
+    {
+        return (seen_[v][i / bits::word_bits] >> (i % bits::word_bits)) & 1;
+    }
+
+private:
+    template <typename Visitor>
+    void report(int v, int level, const source_set &mask, Visitor &visit)
+    {
+        for (int i = 0; i < Words; i++) {
+            for (uint64_t word = mask[i]; word; word &= word - 1) {
+                int src = i * bits::word_bits + bits::count_trailing_zeros(word);
+                reached_count_[src]++;
+                distance_sum_[src] += level;
+            }
+        }
+        visit(v, level, mask);
+    }
+};
+
+}   // namespace unweight
+
+#endif
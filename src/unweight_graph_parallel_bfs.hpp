@@ -0,0 +1,209 @@
+/**
+ * @file unweight_graph_parallel_bfs.hpp
+ * @brief 多线程的按层同步宽度优先搜索(Parallel Breadth-first Search)算法
+ * @author hexu_1985@sina.com
+ * @version 1.0
+ * @date 2020-09-16
+ */
+#ifndef UNWEIGHT_GRAPH_PARALLEL_BFS_INC
+#define UNWEIGHT_GRAPH_PARALLEL_BFS_INC
+
+#include <vector>
+#include <memory>
+#include <atomic>
+#include <cstdint>
+#include <algorithm>
+#include "bit_utils.hpp"
+#include "parallel_utils.hpp"
+
+namespace unweight {
+
+/**
+ * @brief 多线程的按层同步宽度优先搜索算法
+ *
+ * 每一层的顶点分块交给线程池中的线程处理. 线程用原子操作在已探索位图中
+ * 抢占(claim)新顶点, 抢占成功的顶点放入线程自己的下一层缓冲区;
+ * 一层结束后按各缓冲区的大小求前缀和, 各线程把自己的缓冲区并行地复制到下一层中,
+ * 整个过程不使用全局锁.
+ *
+ * @tparam Graph 图类型
+ */
+template <typename Graph>
+class ParallelBFS {
+private:
+    const Graph &graph_;
+    std::unique_ptr<parallel::thread_pool> own_pool_;
+    parallel::thread_pool &pool_;
+    std::vector<std::atomic<uint64_t>> visited_;    // 已探索位图
+    std::vector<int> reached_;                      // 按层排列的所有已探索顶点
+    std::vector<std::vector<int>> local_next_;      // 每个线程的下一层缓冲区
+    int level_count_ = 0;                           // 层数
+
+    static constexpr int chunk_size = 64;           // 每次领取的顶点个数
+
+public:
+    /**
+     * @brief 构造并行BFS对象, 创建自己的线程池
+     *
+     * @param graph 图
+     * @param thread_count 线程个数, 小于1时使用硬件支持的并发线程数
+     */
+    ParallelBFS(const Graph &graph, int thread_count = 0):
+        graph_(graph), own_pool_(std::make_unique<parallel::thread_pool>(thread_count)),
+        pool_(*own_pool_)
+    {
+    }
+
+    /**
+     * @brief 构造并行BFS对象, 使用外部的线程池
+     *
+     * @param graph 图
+     * @param pool 线程池
+     */
+    ParallelBFS(const Graph &graph, parallel::thread_pool &pool): graph_(graph), pool_(pool)
+    {
+    }
+
+    /**
+     * @brief 从s开始搜索, 结果与BFS::search()相同
+     *
+     * @param s 起点
+     */
+    void search(int s)
+    {
+        search_if(s, [](int) { return true; });
+    }
+
+    /**
+     * @brief 从s开始搜索, 只探索满足pred(w)的顶点w
+     *
+     * pred会被多个线程同时调用.
+     *
+     * @param s 起点
+     * @param pred 顶点过滤条件
+     */
+    template <typename Pred>
+    void search_if(int s, Pred pred)
+    {
+        reset_visited();
+
+        int thread_count = pool_.size();
+        local_next_.resize(thread_count);
+
+        claim(s);
+        reached_.push_back(s);
+        level_count_ = 0;
+
+        // 当前层为reached_[first, last)
+        int first = 0;
+        int last = 1;
+        std::vector<int> offsets(thread_count+1);
+        while (first < last) {
+            level_count_++;
+
+            // 各线程分块领取当前层的顶点, 把抢占到的新顶点放入自己的缓冲区
+            for (auto &next: local_next_)
+                next.clear();
+            parallel::parallel_for_chunked(pool_, first, last, chunk_size, [&](int tid, int i) {
+                for (auto w: graph_.get_adj_list(reached_[i])) {
+                    if (!is_visited(w) && pred(w) && claim(w))
+                        local_next_[tid].push_back(w);
+                }
+            });
+
+            // 合并各线程的缓冲区: 先求前缀和, 再并行复制
+            offsets[0] = last;
+            for (int tid = 0; tid < thread_count; tid++)
+                offsets[tid+1] = offsets[tid] + static_cast<int>(local_next_[tid].size());
+            reached_.resize(offsets[thread_count]);
+            pool_.run([&](int tid) {
+                std::copy(local_next_[tid].begin(), local_next_[tid].end(),
+                        reached_.begin() + offsets[tid]);
+            });
+
+            first = last;
+            last = offsets[thread_count];
+        }
+    }
+
+    /**
+     * @brief 顶点是否在最近一次搜索中被探索到(从起点可达)
+     *
+     * @param v 顶点
+     *
+     * @return 如果v可达, 返回true, 否则返回false
+     */
+    bool is_visited(int v) const
+    {
+        return (visited_[v / bits::word_bits].load(std::memory_order_relaxed) >>
+                (v % bits::word_bits)) & 1;
+    }
+
+    /**
+     * @brief 最近一次搜索探索到的所有顶点, 按层排列
+     *
+     * @return 顶点列表
+     */
+    const std::vector<int> &reached() const { return reached_; }
+
+    /**
+     * @brief 最近一次搜索的层数(包括起点所在的第0层)
+     *
+     * @return 层数
+     */
+    int level_count() const { return level_count_; }
+
+    /**
+     * @brief 线程池
+     *
+     * @return 搜索使用的线程池
+     */
+    parallel::thread_pool &pool() { return pool_; }
+
+private:
+    /**
+     * @brief 在位图中原子地抢占顶点v
+     *
+     * @param v 顶点
+     *
+     * @return 如果v由本线程标记为已探索, 返回true; 如果v已经被标记, 返回false
+     */
+    bool claim(int v)
+    {
+        uint64_t mask = uint64_t(1) << (v % bits::word_bits);
+        auto &word = visited_[v / bits::word_bits];
+        uint64_t old = word.load(std::memory_order_relaxed);
+        while (!(old & mask)) {
+            if (word.compare_exchange_weak(old, old | mask, std::memory_order_relaxed))
+                return true;
+        }
+        return false;
+    }
+
+    /**
+     * @brief 清除已探索位图
+     *
+     * 上次搜索探索到的顶点较少时只清除它们所在的字, 否则清除整个位图.
+     */
+    void reset_visited()
+    {
+        int words = bits::word_count(graph_.vertex_count());
+        if ((int) visited_.size() != words) {
+            visited_ = std::vector<std::atomic<uint64_t>>(words);
+            for (auto &word: visited_)
+                word.store(0, std::memory_order_relaxed);
+        } else if ((int) reached_.size() < words) {
+            for (auto v: reached_)
+                visited_[v / bits::word_bits].store(0, std::memory_order_relaxed);
+        } else {
+            parallel::parallel_for(pool_, 0, words, [&](int, int i) {
+                visited_[i].store(0, std::memory_order_relaxed);
+            });
+        }
+        reached_.clear();
+    }
+};
+
+}   // namespace unweight
+
+#endif
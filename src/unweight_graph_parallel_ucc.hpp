@@ -0,0 +1,254 @@
+/**
+ * @file unweight_graph_parallel_ucc.hpp
+ * @brief 基于并查集的多线程无向图连通分量(Parallel Undigraph Connected Components)算法
+ * @author hexu_1985@sina.com
+ * @version 1.0
+ * @date 2020-09-24
+ */
+#ifndef UNWEIGHT_GRAPH_PARALLEL_UCC_INC
+#define UNWEIGHT_GRAPH_PARALLEL_UCC_INC
+
+#include <vector>
+#include <memory>
+#include <atomic>
+#include <random>
+#include <algorithm>
+#include <unordered_map>
+#include "parallel_utils.hpp"
+
+namespace unweight {
+
+/**
+ * @brief 基于并查集的多线程无向图连通分量算法(Afforest)
+ *
+ * 每个顶点保存一个父顶点, 并且父顶点的编号总是不大于自己, 所以每棵树的根就是
+ * 连通分量中编号最小的顶点. 多个线程同时处理不同顶点的边, 用CAS把较大的根
+ * 挂到较小的根下面, 不使用锁.
+ *
+ * 先只处理每个顶点的前几条边(采样), 此时大部分顶点已经并入最大的连通分量;
+ * 之后处理剩余的边时跳过已经属于最大连通分量的顶点, 它们的边由另一端的顶点处理.
+ *
+ * 计算结果与UCC相同: 连通分量按其中编号最小的顶点排序, 从1开始编号.
+ *
+ * @tparam Graph 图类型
+ */
+template <typename Graph>
+class ParallelUCC {
+private:
+    const Graph &graph_;
+    std::unique_ptr<parallel::thread_pool> own_pool_;
+    parallel::thread_pool &pool_;
+    std::vector<std::atomic<int>> parent_;  // 并查集中的父顶点
+    std::vector<int> cc_;                   // 每个顶点所在的连通分量
+    int num_cc_ = 0;                        // 连通分量的个数
+    int neighbor_rounds_ = 2;               // 采样阶段处理每个顶点的前几条边
+
+    static constexpr int chunk_size = 64;   // 每次领取的顶点个数
+    static constexpr int sample_count = 1024;   // 估计最大连通分量时采样的顶点数
+
+public:
+    /**
+     * @brief 构造并行UCC对象, 创建自己的线程池
+     *
+     * @param graph 无向图
+     * @param thread_count 线程个数, 小于1时使用硬件支持的并发线程数
+     */
+    ParallelUCC(const Graph &graph, int thread_count = 0):
+        graph_(graph), own_pool_(std::make_unique<parallel::thread_pool>(thread_count)),
+        pool_(*own_pool_)
+    {
+    }
+
+    /**
+     * @brief 构造并行UCC对象, 使用外部的线程池
+     *
+     * @param graph 无向图
+     * @param pool 线程池
+     */
+    ParallelUCC(const Graph &graph, parallel::thread_pool &pool): graph_(graph), pool_(pool)
+    {
+    }
+
+    /**
+     * @brief 设置采样阶段处理每个顶点的前几条边
+     *
+     * @param rounds 边数, 为0时不采样, 直接处理所有的边
+     */
+    void set_neighbor_rounds(int rounds) { neighbor_rounds_ = std::max(rounds, 0); }
+
+    void calculate()
+    {
+        int n = graph_.vertex_count();
+        if ((int) parent_.size() != n)
+            parent_ = std::vector<std::atomic<int>>(n);
+        parallel::parallel_for(pool_, 0, n, [&](int, int v) {
+            parent_[v].store(v, std::memory_order_relaxed);
+        });
+
+        // 采样: 每一轮处理每个顶点的第r条边
+        for (int r = 0; r < neighbor_rounds_; r++) {
+            parallel::parallel_for(pool_, 0, n, [&](int, int u) {
+                int i = 0;
+                for (auto v: graph_.get_adj_list(u)) {
+                    if (i++ == r) {
+                        link(u, v);
+                        break;
+                    }
+                }
+            });
+            compress();
+        }
+
+        // 处理剩余的边, 跳过已经属于最大连通分量的顶点
+        int giant = neighbor_rounds_ > 0 ? sample_frequent_root() : -1;
+        parallel::parallel_for_chunked(pool_, 0, n, chunk_size, [&](int, int u) {
+            if (parent_[u].load(std::memory_order_relaxed) == giant)
+                return;
+            int i = 0;
+            for (auto v: graph_.get_adj_list(u)) {
+                if (i++ >= neighbor_rounds_)
+                    link(u, v);
+            }
+        });
+        compress();
+
+        label();
+    }
+
+    /**
+     * @brief 连通分量的个数
+     *
+     * @return 个数
+     */
+    int count() const { return num_cc_; }
+
+    /**
+     * @brief 顶点所在的连通分量
+     *
+     * @param v 顶点
+     *
+     * @return 连通分量的编号, 从1开始
+     */
+    int id(int v) const { return cc_[v]; }
+
+    /**
+     * @brief 两个顶点是否连通
+     *
+     * @param v 顶点
+     * @param w 顶点
+     *
+     * @return 如果连通, 返回true, 否则返回false
+     */
+    bool connected(int v, int w) const { return cc_[v] == cc_[w]; }
+
+    /**
+     * @brief 线程池
+     *
+     * @return 计算使用的线程池
+     */
+    parallel::thread_pool &pool() { return pool_; }
+
+private:
+    /**
+     * @brief 合并u和v所在的树: 把较大的根挂到较小的根下面
+     *
+     * 其他线程可能同时修改相关的父顶点, CAS失败时沿着新的父顶点重试.
+     */
+    void link(int u, int v)
+    {
+        int p1 = parent_[u].load(std::memory_order_relaxed);
+        int p2 = parent_[v].load(std::memory_order_relaxed);
+        while (p1 != p2) {
+            int high = std::max(p1, p2);
+            int low = std::min(p1, p2);
+            int p_high = parent_[high].load(std::memory_order_relaxed);
+            // 已经合并
+            if (p_high == low)
+                break;
+            // high是根, 把它挂到low下面
+            if (p_high == high &&
+                    parent_[high].compare_exchange_strong(p_high, low, std::memory_order_relaxed))
+                break;
+            p1 = parent_[parent_[high].load(std::memory_order_relaxed)].load(std::memory_order_relaxed);
+            p2 = parent_[low].load(std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief 路径压缩: 让每个顶点直接指向根
+     */
+    void compress()
+    {
+        parallel::parallel_for(pool_, 0, graph_.vertex_count(), [&](int, int v) {
+            int p = parent_[v].load(std::memory_order_relaxed);
+            int pp = parent_[p].load(std::memory_order_relaxed);
+            while (p != pp) {
+                parent_[v].store(pp, std::memory_order_relaxed);
+                p = pp;
+                pp = parent_[p].load(std::memory_order_relaxed);
+            }
+        });
+    }
+
+    /**
+     * @brief 随机采样一些顶点, 返回出现次数最多的根(近似为最大连通分量)
+     */
+    int sample_frequent_root()
+    {
+        int n = graph_.vertex_count();
+        if (n == 0)
+            return -1;
+
+        std::mt19937 rand(n);
+        std::uniform_int_distribution<int> dist(0, n-1);
+        std::unordered_map<int, int> counts;
+        for (int i = 0; i < sample_count; i++)
+            counts[parent_[dist(rand)].load(std::memory_order_relaxed)]++;
+        return std::max_element(counts.begin(), counts.end(),
+                [](const auto &a, const auto &b) { return a.second < b.second; })->first;
+    }
+
+    /**
+     * @brief 按根的编号顺序给连通分量编号, 根就是连通分量中编号最小的顶点
+     */
+    void label()
+    {
+        int n = graph_.vertex_count();
+        int thread_count = pool_.size();
+        cc_.resize(n);
+
+        // 各线程统计自己负责的区间中根的个数, 再求前缀和
+        std::vector<int> offsets(thread_count+1, 0);
+        pool_.run([&](int tid) {
+            auto [begin, end] = parallel::split_range(0, n, tid, thread_count);
+            int roots = 0;
+            for (int v = begin; v < end; v++) {
+                if (parent_[v].load(std::memory_order_relaxed) == v)
+                    roots++;
+            }
+            offsets[tid+1] = roots;
+        });
+        for (int tid = 0; tid < thread_count; tid++)
+            offsets[tid+1] += offsets[tid];
+        num_cc_ = offsets[thread_count];
+
+        // 先给根编号, 再让其他顶点取根的编号
+        pool_.run([&](int tid) {
+            auto [begin, end] = parallel::split_range(0, n, tid, thread_count);
+            int id = offsets[tid];
+            for (int v = begin; v < end; v++) {
+                if (parent_[v].load(std::memory_order_relaxed) == v)
+                    cc_[v] = ++id;
+            }
+        });
+        parallel::parallel_for(pool_, 0, n, [&](int, int v) {
+            int root = parent_[v].load(std::memory_order_relaxed);
+            if (root != v)
+                cc_[v] = cc_[root];
+        });
+    }
+};
+
+}   // namespace unweight
+
+#endif
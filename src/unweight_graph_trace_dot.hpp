@@ -0,0 +1,260 @@
+/**
+ * @file unweight_graph_trace_dot.hpp
+ * @brief 将图遍历算法(BFS/DFS/UCC/TopoSort)的遍历过程转成dot格式
+ * @author hexu_1985@sina.com
+ * @version 1.0
+ * @date 2020-10-10
+ */
+#ifndef UNWEIGHT_GRAPH_TRACE_DOT_INC
+#define UNWEIGHT_GRAPH_TRACE_DOT_INC
+
+#include <vector>
+#include <string>
+#include <iostream>
+#include <fstream>
+#include "unweight_graph_utils.hpp"
+#include "unweight_graph_visitor.hpp"
+
+namespace unweight {
+
+namespace detail {
+
+inline const std::vector<std::string> &trace_color_list()
+{
+    static const std::vector<std::string> color_list = {"red", "green", "cyan", "violet"};
+    return color_list;
+}
+
+/**
+ * @brief 边(u,v)是否为树边, 无向图中两个方向都算
+ */
+template <typename Graph>
+bool is_trace_tree_edge(const Graph &graph, const trace_visitor &trace, int u, int v)
+{
+    return trace.tree_edge_order(u, v) > 0 ||
+        (!graph.is_directed() && trace.tree_edge_order(v, u) > 0);
+}
+
+/**
+ * @brief 写出DOT文件的框架, 顶点和边的属性由vertex_attr(v)和edge_attr(u, v)给出
+ */
+template <typename Graph, typename VMap, typename VertexAttr, typename EdgeAttr>
+void write_trace_dot(std::ostream &strm, const Graph &graph, const VMap &vmap,
+        VertexAttr vertex_attr, EdgeAttr edge_attr)
+{
+    bool is_digraph = graph.is_directed();
+    std::string title = is_digraph ? "digraph G" : "graph G";
+    std::string line_symbol = is_digraph ? "->" : "--";
+
+    strm << title << " {\n";
+
+    // 打印点集
+    for (auto v: get_vertexes(graph)) {
+        strm << "\t" << vmap[v];
+        vertex_attr(v);
+        strm << ";\n";
+    }
+
+    // 打印边集
+    for (auto e: get_edges(graph)) {
+        auto [u, v] = e;
+        strm << "\t" << vmap[u] << line_symbol << vmap[v];
+        edge_attr(u, v);
+        strm << ";\n";
+    }
+
+    strm << "}\n";
+}
+
+template <typename Writer>
+bool save_trace_dot_file(const char *dot_file, Writer writer)
+{
+    std::ofstream ofile(dot_file);
+    if (!ofile) {
+        std::cout << "open " << dot_file << " failed!\n";
+        return false;
+    }
+
+    writer(ofile);
+    return true;
+}
+
+}   // namespace detail
+
+/**
+ * @brief 把BFS的搜索过程转成DOT语言格式: 顶点标注探索顺序并按层着色, 起点为黄色, 树边加粗
+ *
+ * @tparam Graph 图类型
+ * @tparam VMap map类型：int -> string
+ * @param strm 输出流
+ * @param graph 指定图
+ * @param trace BFS<Graph, trace_visitor>::visitor()
+ * @param vmap 顶点index到顶点name的map
+ */
+template <typename Graph, typename VMap>
+void write_bfs_dot(std::ostream &strm, const Graph &graph, const trace_visitor &trace,
+        const VMap &vmap)
+{
+    const auto &color_list = detail::trace_color_list();
+    detail::write_trace_dot(strm, graph, vmap,
+        [&](int v) {
+            if (trace.is_discovered(v)) {
+                strm << "["
+                    << " label=\"" << vmap[v] << " (#" << trace.discover_order(v) << ")\", "
+                    << " color=";
+                if (trace.source() == v) {
+                    strm << "yellow";
+                } else {
+                    strm << color_list[trace.depth(v)%color_list.size()];
+                }
+                strm << ", style=filled"
+                    << "]";
+            } else {
+                strm << "["
+                    << " label=\"" << vmap[v] << "\"]";
+            }
+        },
+        [&](int u, int v) {
+            if (detail::is_trace_tree_edge(graph, trace, u, v)) {
+                strm << "["
+                    << "color=red"
+                    << ", penwidth=3.0"
+                    << " ]";
+            }
+        });
+}
+
+/**
+ * @brief 把DFS的搜索过程转成DOT语言格式: 顶点标注探索顺序, 起点为黄色, 树边加粗
+ *
+ * @tparam Graph 图类型
+ * @tparam VMap map类型：int -> string
+ * @param strm 输出流
+ * @param graph 指定图
+ * @param trace DFS<Graph, trace_visitor>::visitor()
+ * @param vmap 顶点index到顶点name的map
+ */
+template <typename Graph, typename VMap>
+void write_dfs_dot(std::ostream &strm, const Graph &graph, const trace_visitor &trace,
+        const VMap &vmap)
+{
+    detail::write_trace_dot(strm, graph, vmap,
+        [&](int v) {
+            if (trace.is_discovered(v)) {
+                strm << "["
+                    << " label=\"" << vmap[v] << " (#" << trace.discover_order(v) << ")\", "
+                    << " color=" << (trace.source() == v ? "yellow" : "green")
+                    << ", style=filled"
+                    << "]";
+            } else {
+                strm << "["
+                    << " label=\"" << vmap[v] << "\"]";
+            }
+        },
+        [&](int u, int v) {
+            if (detail::is_trace_tree_edge(graph, trace, u, v)) {
+                strm << "["
+                    << "color=red"
+                    << ", penwidth=3.0"
+                    << " ]";
+            }
+        });
+}
+
+/**
+ * @brief 把UCC的计算过程转成DOT语言格式: 按连通分量着色, 树边标注探索顺序
+ *
+ * @tparam Graph 图类型
+ * @tparam VMap map类型：int -> string
+ * @param strm 输出流
+ * @param graph 指定图
+ * @param trace UCC<Graph, trace_visitor>::visitor()
+ * @param vmap 顶点index到顶点name的map
+ */
+template <typename Graph, typename VMap>
+void write_ucc_dot(std::ostream &strm, const Graph &graph, const trace_visitor &trace,
+        const VMap &vmap)
+{
+    const auto &color_list = detail::trace_color_list();
+    detail::write_trace_dot(strm, graph, vmap,
+        [&](int v) {
+            strm << "["
+                << " color="
+                << color_list[trace.tree(v)%color_list.size()];
+            strm << ", style=filled"
+                << "]";
+        },
+        [&](int u, int v) {
+            int order = trace.tree_edge_order(u, v);
+            if (order == 0 && !graph.is_directed())
+                order = trace.tree_edge_order(v, u);
+            if (order > 0) {
+                strm << "["
+                    << " label=\" #" << order << "\""
+                    << ", color=" << color_list[trace.tree(v)%color_list.size()]
+                    << ", penwidth=3.0"
+                    << " ]";
+            }
+        });
+}
+
+/**
+ * @brief 把拓扑排序的结果转成DOT语言格式: 顶点标注它在拓扑顺序中的位置
+ *
+ * @tparam Graph 图类型
+ * @tparam VMap map类型：int -> string
+ * @param strm 输出流
+ * @param graph 指定图
+ * @param trace TopoSort<Graph, trace_visitor>::visitor()
+ * @param vmap 顶点index到顶点name的map
+ */
+template <typename Graph, typename VMap>
+void write_topo_sort_dot(std::ostream &strm, const Graph &graph, const trace_visitor &trace,
+        const VMap &vmap)
+{
+    // 第一个完成的顶点排在最后
+    int n = graph.vertex_count();
+    detail::write_trace_dot(strm, graph, vmap,
+        [&](int v) {
+            strm << "["
+                << " label=\"" << vmap[v] << " (#" << n + 1 - trace.finish_order(v) << ")\" "
+                << "]";
+        },
+        [&](int, int) {});
+}
+
+template <typename Graph, typename VMap>
+bool save_bfs_dot_file(const char *dot_file, const Graph &graph, const trace_visitor &trace,
+        const VMap &vmap)
+{
+    return detail::save_trace_dot_file(dot_file,
+            [&](std::ostream &strm) { write_bfs_dot(strm, graph, trace, vmap); });
+}
+
+template <typename Graph, typename VMap>
+bool save_dfs_dot_file(const char *dot_file, const Graph &graph, const trace_visitor &trace,
+        const VMap &vmap)
+{
+    return detail::save_trace_dot_file(dot_file,
+            [&](std::ostream &strm) { write_dfs_dot(strm, graph, trace, vmap); });
+}
+
+template <typename Graph, typename VMap>
+bool save_ucc_dot_file(const char *dot_file, const Graph &graph, const trace_visitor &trace,
+        const VMap &vmap)
+{
+    return detail::save_trace_dot_file(dot_file,
+            [&](std::ostream &strm) { write_ucc_dot(strm, graph, trace, vmap); });
+}
+
+template <typename Graph, typename VMap>
+bool save_topo_sort_dot_file(const char *dot_file, const Graph &graph, const trace_visitor &trace,
+        const VMap &vmap)
+{
+    return detail::save_trace_dot_file(dot_file,
+            [&](std::ostream &strm) { write_topo_sort_dot(strm, graph, trace, vmap); });
+}
+
+}   // namespace unweight
+
+#endif
@@ -9,8 +9,10 @@
 #define UNWEIGHT_GRAPH_UCC_INC
 
 #include <vector>
-#include <queue>
+#include <memory>
 #include <algorithm>
+#include "unweight_traversal_workspace.hpp"
+#include "unweight_graph_visitor.hpp"
 
 namespace unweight {
 
@@ -18,60 +20,120 @@ namespace unweight {
  * @brief 无向图连通分量(Undigraph Connected Components, UCC)算法
  *
  * @tparam Graph 图类型
+ * @tparam Visitor 访问者类型, 参见null_visitor
  */
-template <typename Graph>
+template <typename Graph, typename Visitor = null_visitor>
 class UCC {
 private:
     const Graph &graph_;
-    std::vector<bool> visited_;
+    std::unique_ptr<traversal_workspace> own_ws_;
+    traversal_workspace &ws_;   // 已探索标记和队列
+    Visitor vis_;               // 访问者
     std::vector<int> cc_;
     int num_cc_ = 0;
 
 public:
-    UCC(const Graph &graph): graph_(graph)
+    UCC(const Graph &graph, Visitor vis = Visitor()):
+        graph_(graph), own_ws_(std::make_unique<traversal_workspace>()), ws_(*own_ws_),
+        vis_(vis)
     {
     }
 
+    /**
+     * @brief 构造一个使用外部工作区的UCC对象
+     *
+     * 反复计算时, 已探索标记只需O(1)时间重置, 队列也不会重新分配.
+     *
+     * @param graph 图
+     * @param ws 工作区, 可以与其他搜索对象共享
+     * @param vis 访问者
+     */
+    UCC(const Graph &graph, traversal_workspace &ws, Visitor vis = Visitor()):
+        graph_(graph), ws_(ws), vis_(vis)
+    {
+    }
+
+    /**
+     * @brief 访问者
+     *
+     * @return 计算使用的访问者
+     */
+    Visitor &visitor() { return vis_; }
+
+    const Visitor &visitor() const { return vis_; }
+
     void calculate()
     {
-        // 把s标记为已探索，所有其他顶点标记为未探索
-        visited_.resize(graph_.vertex_count());
-        std::fill(std::begin(visited_), std::end(visited_), false);
+        // 把所有顶点标记为未探索
+        ws_.reset(graph_.vertex_count());
+        vis_.initialize(graph_.vertex_count());
 
         num_cc_ = 0;
         cc_.assign(graph_.vertex_count(), -1);
 
         for (int v = 0; v < graph_.vertex_count(); v++) {
-            if (!visited_[v]) {
+            if (!ws_.is_visited(v)) {
                 num_cc_++;
                 search(v);
             }
         }
     }
 
+    /**
+     * @brief 连通分量的个数
+     *
+     * @return 个数
+     */
+    int count() const { return num_cc_; }
+
+    /**
+     * @brief 顶点所在的连通分量
+     *
+     * @param v 顶点
+     *
+     * @return 连通分量的编号, 从1开始
+     */
+    int id(int v) const { return cc_[v]; }
+
+    /**
+     * @brief 两个顶点是否连通
+     *
+     * @param v 顶点
+     * @param w 顶点
+     *
+     * @return 如果连通, 返回true, 否则返回false
+     */
+    bool connected(int v, int w) const { return cc_[v] == cc_[w]; }
+
 private:
     void search(int s)
     {
-        visited_[s] = true;
+        vis_.start_vertex(s);
+        ws_.visit(s);
+        vis_.discover_vertex(s);
 
         // Q := 一个队列数据结构，用s进行初始化
-        std::queue<int> Q;
-        Q.push(s);
+        ws_.clear_queue();
+        ws_.enqueue(s);
 
         // 只要队列不为空，就一直处理
-        while (!Q.empty()) {
+        while (!ws_.queue_empty()) {
             // 从Q的头部删除一个顶点，称之为v
-            auto v = Q.front(); Q.pop();
+            auto v = ws_.dequeue();
             cc_[v] = num_cc_;
 
             // 遍历v的邻接列表
             for (auto w: graph_.get_adj_list(v)) {
-                if (!visited_[w]) {
+                vis_.examine_edge(v, w);
+                if (!ws_.is_visited(w)) {
                     // 如果w为未探索，把w标记为已探索，并且把w添加到Q的尾部
-                    visited_[w] = true;
-                    Q.push(w);
+                    ws_.visit(w);
+                    vis_.tree_edge(v, w);
+                    vis_.discover_vertex(w);
+                    ws_.enqueue(w);
                 }
             }
+            vis_.finish_vertex(v);
         }
     }
 };
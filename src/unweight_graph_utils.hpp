@@ -11,47 +11,84 @@
 
 #include <memory>
 #include <vector>
+#include <utility>
+#include <type_traits>
 
 namespace unweight {
 
+namespace detail {
+
+/**
+ * @brief 判断图类型是否提供了从边列表批量创建图的接口:
+ *        Graph::make_graph(v_cnt, edges, thread_count)和Graph::make_digraph(v_cnt, edges, thread_count)
+ */
+template <typename Graph, typename = void>
+struct has_bulk_builder: std::false_type {};
+
+template <typename Graph>
+struct has_bulk_builder<Graph, std::void_t<
+    decltype(Graph::make_graph(0, std::declval<const std::vector<typename Graph::edge_type> &>(), 1)),
+    decltype(Graph::make_digraph(0, std::declval<const std::vector<typename Graph::edge_type> &>(), 1))>>:
+    std::true_type {};
+
+}   // namespace detail
+
 /**
  * @brief 创建无向图
  *
+ * 如果图类型支持批量创建(例如csr_graph), 则一次性从整个边列表创建图,
+ * 否则逐条插入边.
+ *
  * @tparam Graph 图的类型
  * @param v_cnt 顶点个数
  * @param edges 边列表
+ * @param thread_count 批量创建时使用的线程个数
  *
  * @return 图的对象
  */
 template <typename Graph>
-std::shared_ptr<Graph> make_graph(int v_cnt, const std::vector<typename Graph::edge_type> &edges)
+std::shared_ptr<Graph> make_graph(int v_cnt, const std::vector<typename Graph::edge_type> &edges,
+        int thread_count = 1)
 {
-    auto graph = Graph::make_graph(v_cnt);
+    if constexpr (detail::has_bulk_builder<Graph>::value) {
+        return Graph::make_graph(v_cnt, edges, thread_count);
+    } else {
+        auto graph = Graph::make_graph(v_cnt);
 
-    for (auto edge: edges)
-        graph->insert(edge);
+        for (auto edge: edges)
+            graph->insert(edge);
 
-    return graph;
+        return graph;
+    }
 }
 
 /**
  * @brief 创建有向图
  *
+ * 如果图类型支持批量创建(例如csr_graph), 则一次性从整个边列表创建图,
+ * 否则逐条插入边.
+ *
  * @tparam Graph 图的类型
  * @param v_cnt 顶点个数
  * @param edges 边列表
+ * @param thread_count 批量创建时使用的线程个数
  *
  * @return 图的对象
  */
 template <typename Graph>
-std::shared_ptr<Graph> make_digraph(int v_cnt, const std::vector<typename Graph::edge_type> &edges)
+std::shared_ptr<Graph> make_digraph(int v_cnt, const std::vector<typename Graph::edge_type> &edges,
+        int thread_count = 1)
 {
-    auto graph = Graph::make_digraph(v_cnt);
+    if constexpr (detail::has_bulk_builder<Graph>::value) {
+        return Graph::make_digraph(v_cnt, edges, thread_count);
+    } else {
+        auto graph = Graph::make_digraph(v_cnt);
 
-    for (auto edge: edges)
-        graph->insert(edge);
+        for (auto edge: edges)
+            graph->insert(edge);
 
-    return graph;
+        return graph;
+    }
 }
 
 /**
@@ -0,0 +1,169 @@
+/**
+ * @file unweight_graph_visitor.hpp
+ * @brief 图遍历算法(BFS/DFS/UCC/TopoSort)的访问者(visitor)策略
+ * @author hexu_1985@sina.com
+ * @version 1.0
+ * @date 2020-10-10
+ */
+#ifndef UNWEIGHT_GRAPH_VISITOR_INC
+#define UNWEIGHT_GRAPH_VISITOR_INC
+
+#include <map>
+#include <vector>
+#include <utility>
+
+namespace unweight {
+
+/**
+ * @brief 空的访问者, 遍历算法的默认模板参数
+ *
+ * 遍历算法在以下时刻调用访问者的成员函数:
+ * - initialize(v_cnt): 一次搜索或计算开始时, v_cnt为图的顶点数
+ * - start_vertex(s): 从s开始探索(UCC和TopoSort对每个起点各调用一次)
+ * - discover_vertex(v): v被标记为已探索
+ * - examine_edge(v, w): 检查v的邻接列表中的边(v,w)
+ * - tree_edge(v, w): w经过边(v,w)被探索到, 在discover_vertex(w)之前调用
+ * - finish_vertex(v): v的邻接列表已经检查完
+ *
+ * 所有成员函数都是空的内联函数, 编译器优化后不会产生任何开销.
+ * 自定义的访问者可以继承null_visitor, 只重新定义需要的成员函数.
+ */
+struct null_visitor {
+    void initialize(int) {}
+
+    void start_vertex(int) {}
+
+    void discover_vertex(int) {}
+
+    void examine_edge(int, int) {}
+
+    void tree_edge(int, int) {}
+
+    void finish_vertex(int) {}
+};
+
+/**
+ * @brief 记录遍历过程的访问者, 用于把遍历结果输出成DOT格式
+ *
+ * 记录每个顶点被探索的顺序、在搜索树中的深度、所在的搜索树(起点)和完成的顺序,
+ * 以及每条树边被探索的顺序.
+ */
+class trace_visitor: public null_visitor {
+private:
+    std::vector<int> order_;                    // 每个顶点被探索的顺序, 从0开始, 未探索为-1
+    std::vector<int> depth_;                    // 每个顶点在搜索树中的深度
+    std::vector<int> tree_;                     // 每个顶点所在的搜索树, 从1开始
+    std::vector<int> finish_;                   // 每个顶点完成的顺序, 从1开始
+    std::map<std::pair<int, int>, int> tree_edges_;     // 每条树边被探索的顺序, 从1开始
+    int source_ = -1;                           // 最近一次的起点
+    int tree_count_ = 0;                        // 起点的个数
+    int discover_count_ = 0;                    // 已探索的顶点数
+    int finish_count_ = 0;                      // 已完成的顶点数
+
+public:
+    void initialize(int v_cnt)
+    {
+        order_.assign(v_cnt, -1);
+        depth_.assign(v_cnt, 0);
+        tree_.assign(v_cnt, 0);
+        finish_.assign(v_cnt, 0);
+        tree_edges_.clear();
+        source_ = -1;
+        tree_count_ = discover_count_ = finish_count_ = 0;
+    }
+
+    void start_vertex(int s)
+    {
+        source_ = s;
+        tree_count_++;
+        depth_[s] = 0;
+    }
+
+    void discover_vertex(int v)
+    {
+        order_[v] = discover_count_++;
+        tree_[v] = tree_count_;
+    }
+
+    void tree_edge(int v, int w)
+    {
+        depth_[w] = depth_[v] + 1;
+        int order = static_cast<int>(tree_edges_.size()) + 1;
+        tree_edges_.emplace(std::make_pair(v, w), order);
+    }
+
+    void finish_vertex(int v)
+    {
+        finish_[v] = ++finish_count_;
+    }
+
+    /**
+     * @brief 最近一次的起点
+     *
+     * @return 起点, 没有搜索时为-1
+     */
+    int source() const { return source_; }
+
+    /**
+     * @brief 顶点是否已探索
+     *
+     * @param v 顶点
+     *
+     * @return 如果已探索, 返回true, 否则返回false
+     */
+    bool is_discovered(int v) const { return order_[v] >= 0; }
+
+    /**
+     * @brief 顶点被探索的顺序
+     *
+     * @param v 顶点
+     *
+     * @return 顺序, 从0开始, 未探索为-1
+     */
+    int discover_order(int v) const { return order_[v]; }
+
+    /**
+     * @brief 顶点在搜索树中的深度, 对BFS来说就是到起点的跳数
+     *
+     * @param v 已探索的顶点
+     *
+     * @return 深度, 起点为0
+     */
+    int depth(int v) const { return depth_[v]; }
+
+    /**
+     * @brief 顶点所在的搜索树, 对UCC来说就是连通分量
+     *
+     * @param v 已探索的顶点
+     *
+     * @return 编号, 从1开始
+     */
+    int tree(int v) const { return tree_[v]; }
+
+    /**
+     * @brief 顶点完成的顺序
+     *
+     * @param v 顶点
+     *
+     * @return 顺序, 从1开始, 未完成为0
+     */
+    int finish_order(int v) const { return finish_[v]; }
+
+    /**
+     * @brief 边被作为树边探索的顺序
+     *
+     * @param v 起点
+     * @param w 终点
+     *
+     * @return 顺序, 从1开始, 不是树边时为0
+     */
+    int tree_edge_order(int v, int w) const
+    {
+        auto it = tree_edges_.find(std::make_pair(v, w));
+        return it == tree_edges_.end() ? 0 : it->second;
+    }
+};
+
+}   // namespace unweight
+
+#endif
@@ -0,0 +1,158 @@
+/**
+ * @file unweight_traversal_workspace.hpp
+ * @brief 图遍历算法(BFS/DFS/UCC)可以重复使用的工作区
+ * @author hexu_1985@sina.com
+ * @version 1.0
+ * @date 2020-09-18
+ */
+#ifndef UNWEIGHT_TRAVERSAL_WORKSPACE_INC
+#define UNWEIGHT_TRAVERSAL_WORKSPACE_INC
+
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+
+namespace unweight {
+
+/**
+ * @brief 图遍历算法可以重复使用的工作区
+ *
+ * 已探索标记使用代数(epoch)戳: 每个顶点记录它被标记时的代数, 只有等于当前代数的
+ * 顶点才算已探索. 开始一次新的搜索时只需要把当前代数加1, 不需要O(V)的清零.
+ * 队列和堆栈的缓冲区在多次搜索之间重复使用, 不会重新分配内存.
+ *
+ * 多个搜索对象可以共享同一个工作区, 但每次搜索都会使之前的搜索结果失效.
+ */
+class traversal_workspace {
+private:
+    std::vector<uint32_t> mark_;    // 每个顶点被标记为已探索时的代数
+    uint32_t epoch_ = 0;            // 当前代数
+    std::vector<int> queue_;        // 队列缓冲区, 每个顶点最多入队一次
+    int head_ = 0;                  // 队头
+    int tail_ = 0;                  // 队尾
+    std::vector<int> stack_;        // 堆栈缓冲区
+
+public:
+    /**
+     * @brief 顶点列表, 指向工作区内部的缓冲区
+     */
+    struct vertex_list {
+        const int *first_;
+        const int *last_;
+
+        vertex_list(const int *first, const int *last): first_(first), last_(last) {}
+
+        const int *begin() const { return first_; }
+
+        const int *end() const { return last_; }
+
+        int size() const { return static_cast<int>(last_ - first_); }
+    };
+
+    /**
+     * @brief 构造一个工作区
+     *
+     * @param v_cnt 顶点数, 可以为0, 第一次reset()时再分配
+     */
+    explicit traversal_workspace(int v_cnt = 0)
+    {
+        reset(v_cnt);
+    }
+
+    /**
+     * @brief 开始一次新的搜索: 把所有顶点标记为未探索, 清空队列和堆栈
+     *
+     * 除了顶点数增加或代数溢出时需要重新分配或清零, 时间复杂度为O(1).
+     *
+     * @param v_cnt 图的顶点数
+     */
+    void reset(int v_cnt)
+    {
+        if ((int) mark_.size() < v_cnt) {
+            mark_.resize(v_cnt, 0);
+            queue_.resize(v_cnt);
+        }
+
+        if (++epoch_ == 0) {
+            // 代数溢出, 清除所有旧的标记
+            std::fill(mark_.begin(), mark_.end(), 0);
+            epoch_ = 1;
+        }
+
+        head_ = tail_ = 0;
+        stack_.clear();
+    }
+
+    /**
+     * @brief 当前代数
+     *
+     * 共享工作区的搜索对象可以记下自己搜索时的代数, 之后与当前代数比较,
+     * 判断工作区中的标记是否仍然属于自己的搜索.
+     *
+     * @return 代数, 每次reset()之后改变
+     */
+    uint32_t epoch() const { return epoch_; }
+
+    /**
+     * @brief 顶点是否已探索
+     *
+     * @param v 顶点
+     *
+     * @return 如果v在本次搜索中被标记过, 返回true, 否则返回false
+     */
+    bool is_visited(int v) const { return mark_[v] == epoch_; }
+
+    /**
+     * @brief 把顶点标记为已探索
+     *
+     * @param v 顶点
+     */
+    void visit(int v) { mark_[v] = epoch_; }
+
+    /**
+     * @brief 清空队列, 不影响已探索标记
+     */
+    void clear_queue() { head_ = tail_ = 0; }
+
+    /**
+     * @brief 把顶点添加到队列的尾部
+     *
+     * @param v 顶点
+     */
+    void enqueue(int v) { queue_[tail_++] = v; }
+
+    /**
+     * @brief 从队列的头部删除一个顶点
+     *
+     * @return 被删除的顶点
+     */
+    int dequeue() { return queue_[head_++]; }
+
+    /**
+     * @brief 队列是否为空
+     *
+     * @return 如果队列为空, 返回true, 否则返回false
+     */
+    bool queue_empty() const { return head_ == tail_; }
+
+    /**
+     * @brief 本次搜索中入队过的所有顶点(包括已经出队的), 按入队顺序排列
+     *
+     * 只使用队列的搜索中, 这就是所有已探索顶点的紧凑列表, 长度与探索到的顶点数成正比.
+     * 下一次reset()或clear_queue()之后失效.
+     *
+     * @return 顶点列表
+     */
+    vertex_list queued() const { return vertex_list(queue_.data(), queue_.data() + tail_); }
+
+    /**
+     * @brief 堆栈缓冲区, 使用push_back()/pop_back()操作
+     *
+     * @return 堆栈
+     */
+    std::vector<int> &stack() { return stack_; }
+};
+
+}   // namespace unweight
+
+#endif  // UNWEIGHT_TRAVERSAL_WORKSPACE_INC
@@ -0,0 +1,487 @@
+/**
+ * @file weight_graph_alt.hpp
+ * @brief 基于路标(landmark)和三角不等式的A*搜索算法(ALT)
+ * @author hexu_1985@sina.com
+ * @version 1.0
+ * @date 2020-10-14
+ *
+ * @see Goldberg, Harrelson: Computing the shortest path: A* search meets graph theory (2005)
+ */
+#ifndef WEIGHT_GRAPH_ALT_INC
+#define WEIGHT_GRAPH_ALT_INC
+
+#include <vector>
+#include <memory>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <fstream>
+#include <algorithm>
+#include "weight_graph_dijkstra.hpp"
+#include "weight_graph_astar.hpp"
+
+namespace weight {
+
+/**
+ * @brief 路标距离表
+ *
+ * 对于每个路标L, 保存L到每个顶点的距离d(L,v)和每个顶点到L的距离d(v,L)(无向图中二者相同).
+ * 由三角不等式, d(v,t) >= d(L,t) - d(L,v)且d(v,t) >= d(v,L) - d(t,L), 对所有路标取最大值
+ * 就得到d(v,t)的一个一致的下界. 距离按顶点连续存放, 计算一个顶点的下界时只访问一段连续的内存.
+ *
+ * 预处理需要对每个路标做一次(有向图为两次)Dijkstra搜索, 结果可以用save()保存,
+ * 之后用load()读入, 不需要重复预处理. 距离表同时记录建立时图的顶点数、边数、是否有向
+ * 和所有边的校验和, 用matches()检查它是否属于一个图. 每次build()或load()成功之后版本号加1,
+ * 使用距离表的对象可以据此发现距离表被替换.
+ */
+class landmark_table {
+private:
+    int v_cnt_ = 0;                     // 顶点数
+    bool directed_ = false;             // 是否为有向图
+    int e_cnt_ = 0;                     // 边数
+    uint64_t checksum_ = 0;             // 所有边(起点, 终点, 权重)的校验和
+    uint64_t version_ = 0;              // 版本号, 每次build()或load()成功之后加1
+    std::vector<int> landmarks_;        // 路标
+    std::vector<double> from_;          // from_[v*k+i] = d(L_i, v)
+    std::vector<double> to_;            // to_[v*k+i] = d(v, L_i), 只用于有向图
+
+    static constexpr char magic[4] = {'A', 'L', 'T', '2'};
+
+public:
+    landmark_table() = default;
+
+    /**
+     * @brief 选择k个路标并计算距离表
+     *
+     * 使用farthest策略: 第一个路标是离顶点0最远的顶点, 之后每次选择离已有路标最远的顶点,
+     * 这样路标分布在图的边缘, 下界更紧. 不可达的顶点被当作最远的顶点, 从而覆盖每个连通分量.
+     *
+     * @tparam Graph 图类型, weight::sparse_multi_graph或weight::dense_graph
+     * @param graph 图, 权重必须非负
+     * @param k 路标个数
+     */
+    template <typename Graph>
+    void build(const Graph &graph, int k)
+    {
+        int n = graph.vertex_count();
+        v_cnt_ = n;
+        directed_ = graph.is_directed();
+        e_cnt_ = graph.edge_count();
+        checksum_ = edge_checksum(graph);
+        k = std::min(k, n);
+        version_++;
+        landmarks_.clear();
+        from_.assign((size_t) n * k, shortest_path_workspace::infinity);
+        to_.assign(directed_ ? (size_t) n * k : 0, shortest_path_workspace::infinity);
+        if (k == 0)
+            return;
+
+        // 有向图的入边视图: 所有边反向的图
+        std::vector<typename Graph::edge_type> reverse_edges;
+        std::unique_ptr<Graph> reverse;
+        if (directed_) {
+            reverse = std::make_unique<Graph>(n, true);
+            reverse_edges.reserve(graph.edge_count());
+            for (int v = 0; v < n; v++) {
+                for (auto e: graph.get_adj_list(v))
+                    reverse_edges.emplace_back(e->to(), e->from(), e->weight());
+            }
+            for (auto &e: reverse_edges)
+                reverse->insert(&e);
+        }
+
+        Dijkstra<Graph, dary_heap<4>> dijkstra(graph);
+        std::unique_ptr<Dijkstra<Graph, dary_heap<4>>> reverse_dijkstra;
+        if (directed_)
+            reverse_dijkstra = std::make_unique<Dijkstra<Graph, dary_heap<4>>>(*reverse);
+
+        // closest[v]: v到已有路标的最小距离
+        std::vector<double> closest(n, shortest_path_workspace::infinity);
+        dijkstra.search(0);
+        int next = farthest(dijkstra, closest, true);
+        for (int i = 0; i < k; i++) {
+            int landmark = next;
+            landmarks_.push_back(landmark);
+
+            dijkstra.search(landmark);
+            for (int v = 0; v < n; v++)
+                from_[(size_t) v * k + i] = dijkstra.distance(v);
+            if (directed_) {
+                reverse_dijkstra->search(landmark);
+                for (int v = 0; v < n; v++)
+                    to_[(size_t) v * k + i] = reverse_dijkstra->distance(v);
+            }
+
+            next = farthest(dijkstra, closest, false);
+        }
+    }
+
+    /**
+     * @brief 顶点数
+     *
+     * @return 建立距离表时图的顶点数
+     */
+    int vertex_count() const { return v_cnt_; }
+
+    /**
+     * @brief 版本号
+     *
+     * @return 每次build()或load()成功之后加1
+     */
+    uint64_t version() const { return version_; }
+
+    /**
+     * @brief 距离表是否是对这个图建立的
+     *
+     * 比较顶点数、边数、是否有向和边的校验和, 需要O(V+E)时间.
+     * 建立距离表之后修改过的图(插入边或者改变权重)也不匹配.
+     *
+     * @tparam Graph 图类型
+     * @param graph 图
+     *
+     * @return 如果匹配, 返回true, 否则返回false
+     */
+    template <typename Graph>
+    bool matches(const Graph &graph) const
+    {
+        return v_cnt_ == graph.vertex_count() && directed_ == graph.is_directed() &&
+            e_cnt_ == graph.edge_count() && checksum_ == edge_checksum(graph);
+    }
+
+    /**
+     * @brief 路标个数
+     *
+     * @return 个数
+     */
+    int landmark_count() const { return static_cast<int>(landmarks_.size()); }
+
+    /**
+     * @brief 路标
+     *
+     * @return 所有路标
+     */
+    const std::vector<int> &landmarks() const { return landmarks_; }
+
+    /**
+     * @brief 从v到t的距离的下界
+     *
+     * @param v 顶点
+     * @param t 终点
+     *
+     * @return 下界, 不小于0; v或t不是距离表中的顶点时为0
+     */
+    double lower_bound(int v, int t) const
+    {
+        if (v < 0 || v >= v_cnt_ || t < 0 || t >= v_cnt_)
+            return 0;
+
+        int k = landmark_count();
+        const double *fv = from_.data() + (size_t) v * k;
+        const double *ft = from_.data() + (size_t) t * k;
+        const double *tv = directed_ ? to_.data() + (size_t) v * k : fv;
+        const double *tt = directed_ ? to_.data() + (size_t) t * k : ft;
+
+        double bound = 0;
+        for (int i = 0; i < k; i++) {
+            // 只有两个距离都有限时, 三角不等式才给出有用的下界
+            if (fv[i] != shortest_path_workspace::infinity &&
+                    ft[i] != shortest_path_workspace::infinity)
+                bound = std::max(bound, ft[i] - fv[i]);
+            if (tv[i] != shortest_path_workspace::infinity &&
+                    tt[i] != shortest_path_workspace::infinity)
+                bound = std::max(bound, tv[i] - tt[i]);
+        }
+        return bound;
+    }
+
+    /**
+     * @brief 以二进制格式保存距离表
+     *
+     * @param strm 输出流
+     *
+     * @return 如果成功, 返回true, 否则返回false
+     */
+    bool save(std::ostream &strm) const
+    {
+        int32_t header[4] = {v_cnt_, landmark_count(), directed_ ? 1 : 0, e_cnt_};
+        strm.write(magic, sizeof(magic));
+        strm.write(reinterpret_cast<const char *>(header), sizeof(header));
+        strm.write(reinterpret_cast<const char *>(&checksum_), sizeof(checksum_));
+        strm.write(reinterpret_cast<const char *>(landmarks_.data()),
+                landmarks_.size() * sizeof(int));
+        strm.write(reinterpret_cast<const char *>(from_.data()), from_.size() * sizeof(double));
+        strm.write(reinterpret_cast<const char *>(to_.data()), to_.size() * sizeof(double));
+        return static_cast<bool>(strm);
+    }
+
+    /**
+     * @brief 读入save()保存的距离表
+     *
+     * @param strm 输入流
+     *
+     * @return 如果成功, 返回true; 如果格式不正确, 数据不完整或者路标不是合法的顶点, 返回false,
+     * 距离表不变. 数组按块读入, 头部中的长度不会导致分配超过流中实际数据的内存.
+     */
+    bool load(std::istream &strm)
+    {
+        char tag[sizeof(magic)];
+        int32_t header[4];
+        uint64_t checksum;
+        if (!strm.read(tag, sizeof(tag)) || std::memcmp(tag, magic, sizeof(magic)) != 0)
+            return false;
+        if (!strm.read(reinterpret_cast<char *>(header), sizeof(header)) ||
+                header[0] < 0 || header[1] < 0 || header[1] > header[0] ||
+                (header[2] != 0 && header[2] != 1) || header[3] < 0)
+            return false;
+        if (!strm.read(reinterpret_cast<char *>(&checksum), sizeof(checksum)))
+            return false;
+
+        int n = header[0];
+        int k = header[1];
+        bool directed = header[2] == 1;
+        if (k > 0 && (size_t) n > std::vector<double>().max_size() / k)
+            return false;
+        size_t size = (size_t) n * k;
+        std::vector<int> landmarks;
+        std::vector<double> from;
+        std::vector<double> to;
+        if (!read_array(strm, landmarks, k) || !read_array(strm, from, size) ||
+                !read_array(strm, to, directed ? size : 0))
+            return false;
+        for (auto v: landmarks) {
+            if (v < 0 || v >= n)
+                return false;
+        }
+
+        v_cnt_ = n;
+        directed_ = directed;
+        e_cnt_ = header[3];
+        checksum_ = checksum;
+        landmarks_.swap(landmarks);
+        from_.swap(from);
+        to_.swap(to);
+        version_++;
+        return true;
+    }
+
+    /**
+     * @brief 把距离表保存到文件
+     *
+     * @param file 文件名
+     *
+     * @return 如果成功, 返回true, 否则返回false
+     */
+    bool save(const char *file) const
+    {
+        std::ofstream ofile(file, std::ios::binary);
+        if (!ofile) {
+            std::cout << "open " << file << " failed!\n";
+            return false;
+        }
+        return save(ofile);
+    }
+
+    /**
+     * @brief 从文件读入距离表
+     *
+     * @param file 文件名
+     *
+     * @return 如果成功, 返回true, 否则返回false
+     */
+    bool load(const char *file)
+    {
+        std::ifstream ifile(file, std::ios::binary);
+        if (!ifile) {
+            std::cout << "open " << file << " failed!\n";
+            return false;
+        }
+        return load(ifile);
+    }
+
+private:
+    /**
+     * @brief 从流中读入count个元素到arr, 每次最多分配一块, 流中的数据不足时返回false
+     */
+    template <typename T>
+    static bool read_array(std::istream &strm, std::vector<T> &arr, size_t count)
+    {
+        const size_t block = (size_t) 1 << 16;
+        arr.clear();
+        while (arr.size() < count) {
+            size_t first = arr.size();
+            arr.resize(first + std::min(block, count - first));
+            if (!strm.read(reinterpret_cast<char *>(arr.data() + first),
+                        (arr.size() - first) * sizeof(T)))
+                return false;
+        }
+        return true;
+    }
+
+    /**
+     * @brief 图中所有边的校验和
+     *
+     * 对邻接列表中的每一项(v, w, 权重)计算一个64位的散列值再求和, 与边的插入顺序无关.
+     */
+    template <typename Graph>
+    static uint64_t edge_checksum(const Graph &graph)
+    {
+        uint64_t sum = 0;
+        for (int v = 0; v < graph.vertex_count(); v++) {
+            for (auto e: graph.get_adj_list(v)) {
+                double weight = e->weight();
+                uint64_t bits;
+                std::memcpy(&bits, &weight, sizeof(bits));
+                uint64_t h = mix(((uint64_t) (uint32_t) v << 32) | (uint32_t) e->other(v));
+                sum += mix(h ^ bits);
+            }
+        }
+        return sum;
+    }
+
+    /**
+     * @brief 64位整数的散列函数(splitmix64的终结步骤)
+     */
+    static uint64_t mix(uint64_t x)
+    {
+        x ^= x >> 30;
+        x *= 0xbf58476d1ce4e5b9ULL;
+        x ^= x >> 27;
+        x *= 0x94d049bb133111ebULL;
+        x ^= x >> 31;
+        return x;
+    }
+
+    /**
+     * @brief 用最近一次搜索的距离更新closest, 返回离已有路标最远的顶点
+     *
+     * @param reset 为true时只用最近一次搜索的距离, 不更新closest
+     */
+    template <typename Search>
+    int farthest(const Search &search, std::vector<double> &closest, bool reset)
+    {
+        int best = 0;
+        double best_dist = -1;
+        for (int v = 0; v < v_cnt_; v++) {
+            double d = search.distance(v);
+            if (!reset)
+                d = closest[v] = std::min(closest[v], d);
+            if (std::find(landmarks_.begin(), landmarks_.end(), v) != landmarks_.end())
+                continue;
+            if (d > best_dist) {
+                best_dist = d;
+                best = v;
+            }
+        }
+        return best;
+    }
+};
+
+/**
+ * @brief 基于路标和三角不等式的A*搜索算法(ALT: A*, Landmarks, Triangle inequality)
+ *
+ * @tparam Graph 图类型, weight::sparse_multi_graph或weight::dense_graph
+ * @tparam Heap 优先队列类型, 参见weight_heap.hpp
+ */
+template <typename Graph, typename Heap = binary_heap>
+class ALT {
+private:
+    const Graph &graph_;
+    const landmark_table &table_;
+    AStar<Graph, Heap> astar_;
+    bool table_matches_ = false;    // 距离表是否是对这个图建立的
+    uint64_t checked_version_ = 0;  // 检查时距离表的版本号
+    int checked_v_cnt_ = -1;        // 检查时图的顶点数
+    int checked_e_cnt_ = -1;        // 检查时图的边数
+
+public:
+    /**
+     * @brief 构造ALT对象
+     *
+     * 如果距离表不是对这个图建立的(例如读入了另一个图的距离表, 或者建立之后图被修改过),
+     * table_matches()返回false, 查询时不使用距离表, 相当于Dijkstra算法.
+     * 图的顶点数或边数变化, 或者距离表重新建立或读入之后, 下一次查询前重新检查.
+     *
+     * @param graph 图
+     * @param table 对这个图建立或读入的路标距离表
+     */
+    ALT(const Graph &graph, const landmark_table &table):
+        graph_(graph), table_(table), astar_(graph)
+    {
+    }
+
+    /**
+     * @brief 构造一个使用外部工作区的ALT对象
+     *
+     * @param graph 图
+     * @param table 对这个图建立或读入的路标距离表
+     * @param ws 工作区, 可以与其他最短路径对象共享
+     */
+    ALT(const Graph &graph, const landmark_table &table, shortest_path_workspace &ws):
+        graph_(graph), table_(table), astar_(graph, ws)
+    {
+    }
+
+    /**
+     * @brief 距离表是否与图匹配
+     *
+     * @return 如果距离表是对这个图当前的状态建立的, 返回true, 否则返回false
+     */
+    bool table_matches()
+    {
+        check_table();
+        return table_matches_;
+    }
+
+    /**
+     * @brief 计算从s到t的最短路径
+     *
+     * @param s 起点
+     * @param t 终点
+     *
+     * @return s到t的最短距离, 不可达时为shortest_path_workspace::infinity
+     */
+    double search(int s, int t)
+    {
+        check_table();
+        if (!table_matches_)
+            return astar_.search(s, t, [](int) { return 0.0; });
+        return astar_.search(s, t, [this, t](int v) { return table_.lower_bound(v, t); });
+    }
+
+    /**
+     * @brief 最近一次查询中从起点到t的最短路径
+     *
+     * @param t 终点
+     *
+     * @return 路径上的顶点(包括起点和终点), t不可达时为空
+     */
+    std::vector<int> path_to(int t) const { return astar_.path_to(t); }
+
+    /**
+     * @brief 最近一次查询完成的顶点数
+     *
+     * @return 顶点数
+     */
+    int settled_count() const { return astar_.settled_count(); }
+
+private:
+    /**
+     * @brief 检查距离表是否与图匹配
+     *
+     * 只在图的顶点数或边数, 或者距离表的版本号变化时重新检查.
+     */
+    void check_table()
+    {
+        if (table_.version() == checked_version_ && graph_.vertex_count() == checked_v_cnt_ &&
+                graph_.edge_count() == checked_e_cnt_)
+            return;
+        checked_version_ = table_.version();
+        checked_v_cnt_ = graph_.vertex_count();
+        checked_e_cnt_ = graph_.edge_count();
+        table_matches_ = table_.matches(graph_);
+    }
+};
+
+}   // namespace weight
+
+#endif
@@ -0,0 +1,150 @@
+/**
+ * @file weight_graph_astar.hpp
+ * @brief 点对点最短路径的A*搜索算法
+ * @author hexu_1985@sina.com
+ * @version 1.0
+ * @date 2020-10-14
+ */
+#ifndef WEIGHT_GRAPH_ASTAR_INC
+#define WEIGHT_GRAPH_ASTAR_INC
+
+#include <vector>
+#include <memory>
+#include "weight_heap.hpp"
+#include "weight_shortest_path_workspace.hpp"
+
+namespace weight {
+
+/**
+ * @brief 点对点最短路径的A*搜索算法
+ *
+ * 与Dijkstra算法相同, 但优先队列的键值为dist(v) + h(v), h(v)是从v到终点t的距离的下界(启发函数).
+ * 搜索偏向终点的方向, 完成的顶点比Dijkstra算法少. h = 0时就是Dijkstra算法.
+ * h必须是可采纳的(admissible), 即不超过真实距离; 如果h还是一致的(consistent),
+ * 即h(v) <= w(v,w) + h(w), 每个顶点最多完成一次, 否则距离变小的已完成顶点会被重新放入优先队列.
+ * 每个顶点的h(v)只在第一次到达时计算一次.
+ *
+ * @tparam Graph 图类型, weight::sparse_multi_graph或weight::dense_graph
+ * @tparam Heap 优先队列类型, 参见weight_heap.hpp
+ */
+template <typename Graph, typename Heap = binary_heap>
+class AStar {
+private:
+    const Graph &graph_;
+    std::unique_ptr<shortest_path_workspace> own_ws_;
+    shortest_path_workspace &ws_;   // 距离和前驱顶点
+    Heap heap_;                     // 优先队列
+    std::vector<double> h_;         // 每个已到达顶点的启发函数值
+    int settled_count_ = 0;         // 最近一次查询完成的顶点数
+    uint32_t epoch_ = 0;            // 最近一次查询时工作区的代数
+
+public:
+    AStar(const Graph &graph):
+        graph_(graph), own_ws_(std::make_unique<shortest_path_workspace>()), ws_(*own_ws_)
+    {
+    }
+
+    /**
+     * @brief 构造一个使用外部工作区的A*对象
+     *
+     * @param graph 图
+     * @param ws 工作区, 可以与其他最短路径对象共享
+     */
+    AStar(const Graph &graph, shortest_path_workspace &ws): graph_(graph), ws_(ws)
+    {
+    }
+
+    /**
+     * @brief 计算从s到t的最短路径
+     *
+     * @param s 起点
+     * @param t 终点
+     * @param h 启发函数, h(v)返回从v到t的距离的下界
+     *
+     * @return s到t的最短距离, 不可达时为shortest_path_workspace::infinity
+     */
+    template <typename Heuristic>
+    double search(int s, int t, Heuristic h)
+    {
+        int n = graph_.vertex_count();
+        ws_.reset(n);
+        epoch_ = ws_.epoch();
+        heap_.clear(n);
+        if ((int) h_.size() < n)
+            h_.resize(n);
+        settled_count_ = 0;
+
+        ws_.update(s, 0, -1);
+        h_[s] = h(s);
+        heap_.push(s, h_[s]);
+
+        while (!heap_.empty()) {
+            auto [f, v] = heap_.pop();
+            double dv = ws_.distance(v);
+            // 延迟删除: 跳过距离已经变小的旧元素
+            if (f > dv + h_[v])
+                continue;
+
+            settled_count_++;
+            if (v == t)
+                break;
+
+            for (auto e: graph_.get_adj_list(v)) {
+                int w = e->other(v);
+                double dw = dv + e->weight();
+                if (!ws_.is_reached(w)) {
+                    h_[w] = h(w);
+                } else if (dw >= ws_.distance(w)) {
+                    continue;
+                }
+                ws_.update(w, dw, v);
+                heap_.push(w, dw + h_[w]);
+            }
+        }
+
+        return ws_.distance(t);
+    }
+
+    /**
+     * @brief 最近一次查询中顶点到起点的距离
+     *
+     * 只有终点和已完成的顶点的距离一定是最短距离.
+     *
+     * @param v 顶点
+     *
+     * @return 距离, 未到达, 或者共享工作区的其他对象查询之后为shortest_path_workspace::infinity
+     */
+    double distance(int v) const
+    {
+        return is_current() ? ws_.distance(v) : shortest_path_workspace::infinity;
+    }
+
+    /**
+     * @brief 最近一次查询中从起点到t的最短路径
+     *
+     * @param t 终点
+     *
+     * @return 路径上的顶点(包括起点和终点), t不可达, 或者共享工作区的其他对象查询之后为空
+     */
+    std::vector<int> path_to(int t) const
+    {
+        return is_current() ? ws_.path_to(t) : std::vector<int>();
+    }
+
+    /**
+     * @brief 最近一次查询完成(从优先队列中取出)的顶点数
+     *
+     * @return 顶点数
+     */
+    int settled_count() const { return settled_count_; }
+
+private:
+    /**
+     * @brief 工作区中的距离是否仍然属于本对象最近一次的查询
+     */
+    bool is_current() const { return epoch_ != 0 && ws_.epoch() == epoch_; }
+};
+
+}   // namespace weight
+
+#endif
@@ -0,0 +1,464 @@
+/**
+ * @file weight_graph_bellman_ford.hpp
+ * @brief 允许负权重的单源最短路径: 多线程的Bellman-Ford算法和基于队列的SPFA算法, 可以找出负环
+ * @author hexu_1985@sina.com
+ * @version 1.0
+ * @date 2020-10-16
+ *
+ * @see Cherkassky, Goldberg: Negative-cycle detection algorithms (1999)
+ */
+#ifndef WEIGHT_GRAPH_BELLMAN_FORD_INC
+#define WEIGHT_GRAPH_BELLMAN_FORD_INC
+
+#include <vector>
+#include <memory>
+#include <deque>
+#include <atomic>
+#include <limits>
+#include <algorithm>
+#include "parallel_utils.hpp"
+#include "weight_shortest_path_workspace.hpp"
+
+namespace weight {
+
+/**
+ * @brief 在前驱图中查找一个环
+ *
+ * 松弛操作保证前驱图(每个顶点指向它的前驱顶点)中的环都是负环; 反过来, 如果从起点可以到达负环,
+ * 有限次松弛之后前驱图中一定会出现环. 前驱图中每个顶点最多只有一条出边, 从每个未访问的顶点
+ * 沿前驱走到已访问的顶点或者-1, 遇到本次走过的顶点就找到了环, 时间复杂度为O(V).
+ *
+ * @param v_cnt 顶点数
+ * @param parent 函数, parent(v)返回v的前驱顶点, 没有前驱时返回-1
+ *
+ * @return 环上的顶点, 按边的方向排列(最后一个顶点有一条边指向第一个顶点); 没有环时为空
+ */
+template <typename Parent>
+std::vector<int> find_parent_cycle(int v_cnt, Parent parent)
+{
+    std::vector<int> walk(v_cnt, -1);   // 第一次访问顶点时的起点
+    for (int start = 0; start < v_cnt; start++) {
+        int v = start;
+        while (v != -1 && walk[v] == -1) {
+            walk[v] = start;
+            v = parent(v);
+        }
+        if (v == -1 || walk[v] != start)
+            continue;
+
+        // v在环上, 沿前驱得到的是反向的环
+        std::vector<int> cycle;
+        int u = v;
+        do {
+            cycle.push_back(u);
+            u = parent(u);
+        } while (u != v);
+        std::reverse(cycle.begin(), cycle.end());
+        return cycle;
+    }
+    return std::vector<int>();
+}
+
+/**
+ * @brief 多线程的单源最短路径Bellman-Ford算法, 允许负权重
+ *
+ * 第k轮用第k-1轮的距离松弛所有入边, 得到最多经过k条边的最短路径的长度(Jacobi式的迭代).
+ * 每一轮中每个顶点只由一个线程计算和写入, 不需要原子操作, 结果与线程个数无关.
+ * 只有上一轮距离变小的顶点的出边才需要松弛: 这些顶点把出邻居标记为下一轮要计算的顶点,
+ * 被标记的顶点只从距离变小的入邻居拉取距离. 某一轮没有距离变小时提前结束.
+ *
+ * 最短路径最多有V-1条边, 如果第V轮仍有距离变小, 说明从起点可以到达负环.
+ * 为了尽早发现负环, 在轮数为2的幂时还会检查前驱图中是否已经出现环.
+ * 无向图中的每条边相当于两条方向相反的有向边, 所以一条负权重的边本身就是一个负环.
+ *
+ * @tparam Graph 图类型, weight::sparse_multi_graph或weight::dense_graph
+ */
+template <typename Graph>
+class BellmanFord {
+public:
+    /**
+     * @brief 不可达顶点的距离
+     */
+    static constexpr double infinity = std::numeric_limits<double>::infinity();
+
+private:
+    struct in_edge {
+        int from;
+        double weight;
+    };
+
+    struct update {
+        int v;
+        int parent;
+        double dist;
+    };
+
+    const Graph &graph_;
+    std::unique_ptr<parallel::thread_pool> own_pool_;
+    parallel::thread_pool &pool_;
+    std::vector<int> in_offset_;                    // 顶点w的入边为in_edges_[in_offset_[w], in_offset_[w+1])
+    std::vector<in_edge> in_edges_;                 // 按终点连续存放的入边
+    std::vector<double> dist_;                      // 每个顶点到起点的距离
+    std::vector<int> parent_;                       // 每个顶点的前驱顶点
+    std::vector<int> changed_;                      // 顶点的距离最近一次变小的轮数
+    std::vector<std::atomic<int>> marked_;          // 顶点最近一次被标记为要计算的轮数
+    std::vector<std::vector<int>> local_;           // 每个线程标记的顶点
+    std::vector<std::vector<update>> updates_;      // 每个线程本轮计算出的更小的距离
+    std::vector<int> active_;                       // 上一轮距离变小的顶点
+    std::vector<int> frontier_;                     // 本轮要计算的顶点
+    std::vector<int> cycle_;                        // 找到的负环
+    int round_count_ = 0;                           // 最近一次搜索的轮数
+
+    static constexpr int chunk_size = 64;           // 每次领取的顶点个数
+
+public:
+    /**
+     * @brief 构造Bellman-Ford对象, 创建自己的线程池
+     *
+     * @param graph 图
+     * @param thread_count 线程个数, 小于1时使用硬件支持的并发线程数
+     */
+    BellmanFord(const Graph &graph, int thread_count = 0):
+        graph_(graph), own_pool_(std::make_unique<parallel::thread_pool>(thread_count)),
+        pool_(*own_pool_)
+    {
+    }
+
+    /**
+     * @brief 构造Bellman-Ford对象, 使用外部的线程池
+     *
+     * @param graph 图
+     * @param pool 线程池
+     */
+    BellmanFord(const Graph &graph, parallel::thread_pool &pool): graph_(graph), pool_(pool)
+    {
+    }
+
+    /**
+     * @brief 计算从s到所有顶点的最短路径
+     *
+     * 如果从s可以到达负环, 找到负环后立即停止, 这时的距离没有意义.
+     *
+     * @param s 起点
+     */
+    void search(int s)
+    {
+        int n = graph_.vertex_count();
+        int thread_count = pool_.size();
+        build_in_edges();
+
+        dist_.assign(n, infinity);
+        parent_.assign(n, -1);
+        changed_.assign(n, -1);
+        if ((int) marked_.size() != n)
+            marked_ = std::vector<std::atomic<int>>(n);
+        parallel::parallel_for(pool_, 0, n, [&](int, int v) {
+            marked_[v].store(-1, std::memory_order_relaxed);
+        });
+        local_.resize(thread_count);
+        updates_.resize(thread_count);
+        cycle_.clear();
+
+        dist_[s] = 0;
+        changed_[s] = 0;
+        active_.assign(1, s);
+
+        round_count_ = 0;
+        while (!active_.empty()) {
+            int round = ++round_count_;
+            if (round >= n + 1 || ((round & (round - 1)) == 0 && round >= 2)) {
+                cycle_ = find_parent_cycle(n, [this](int v) { return parent_[v]; });
+                if (!cycle_.empty() || round >= n + 1)
+                    break;
+            }
+
+            // 1. 上一轮距离变小的顶点标记它们的出邻居
+            parallel::for_each_chunked(pool_, active_, chunk_size, [&](int u, int tid) {
+                for (auto e: graph_.get_adj_list(u)) {
+                    int w = e->other(u);
+                    if (marked_[w].exchange(round, std::memory_order_relaxed) != round)
+                        local_[tid].push_back(w);
+                }
+            });
+            frontier_.clear();
+            for (auto &local: local_) {
+                frontier_.insert(frontier_.end(), local.begin(), local.end());
+                local.clear();
+            }
+
+            // 2. 被标记的顶点从上一轮距离变小的入邻居拉取距离, 只读dist_, 更新先保存在各线程中
+            parallel::for_each_chunked(pool_, frontier_, chunk_size, [&](int w, int tid) {
+                double best = dist_[w];
+                int parent = -1;
+                for (int i = in_offset_[w]; i < in_offset_[w+1]; i++) {
+                    int u = in_edges_[i].from;
+                    if (changed_[u] != round - 1)
+                        continue;
+                    double d = dist_[u] + in_edges_[i].weight;
+                    if (d < best) {
+                        best = d;
+                        parent = u;
+                    }
+                }
+                if (parent != -1)
+                    updates_[tid].push_back({w, parent, best});
+            });
+
+            // 3. 各线程应用自己的更新(顶点互不相同), 距离变小的顶点就是下一轮的活跃顶点
+            pool_.run([&](int tid) {
+                for (auto &u: updates_[tid]) {
+                    dist_[u.v] = u.dist;
+                    parent_[u.v] = u.parent;
+                    changed_[u.v] = round;
+                }
+            });
+            active_.clear();
+            for (auto &updates: updates_) {
+                for (auto &u: updates)
+                    active_.push_back(u.v);
+                updates.clear();
+            }
+        }
+    }
+
+    /**
+     * @brief 最近一次搜索中是否找到了负环
+     *
+     * @return 如果从起点可以到达负环, 返回true, 否则返回false
+     */
+    bool has_negative_cycle() const { return !cycle_.empty(); }
+
+    /**
+     * @brief 最近一次搜索找到的负环
+     *
+     * @return 环上的顶点, 按边的方向排列(最后一个顶点有一条边指向第一个顶点); 没有负环时为空
+     */
+    const std::vector<int> &negative_cycle() const { return cycle_; }
+
+    /**
+     * @brief 顶点到起点的最短距离
+     *
+     * @param v 顶点
+     *
+     * @return 距离, 不可达时为infinity
+     */
+    double distance(int v) const { return dist_[v]; }
+
+    /**
+     * @brief 是否存在从起点到v的路径
+     *
+     * @param v 顶点
+     *
+     * @return 如果可达, 返回true, 否则返回false
+     */
+    bool has_path_to(int v) const { return dist_[v] != infinity; }
+
+    /**
+     * @brief 从起点到t的最短路径
+     *
+     * @param t 终点
+     *
+     * @return 路径上的顶点(包括起点和终点), t不可达或者有负环时为空
+     */
+    std::vector<int> path_to(int t) const
+    {
+        std::vector<int> path;
+        if (!has_path_to(t) || has_negative_cycle())
+            return path;
+
+        for (int v = t; v != -1; v = parent_[v])
+            path.push_back(v);
+        std::reverse(path.begin(), path.end());
+        return path;
+    }
+
+    /**
+     * @brief 最近一次搜索的轮数
+     *
+     * @return 轮数, 没有负环时不超过最短路径的最多边数加1
+     */
+    int round_count() const { return round_count_; }
+
+    /**
+     * @brief 线程池
+     *
+     * @return 搜索使用的线程池
+     */
+    parallel::thread_pool &pool() { return pool_; }
+
+private:
+    /**
+     * @brief 把图的边按终点整理成连续的入边数组(CSR)
+     */
+    void build_in_edges()
+    {
+        int n = graph_.vertex_count();
+        in_offset_.assign(n + 1, 0);
+        for (int v = 0; v < n; v++) {
+            for (auto e: graph_.get_adj_list(v))
+                in_offset_[e->other(v) + 1]++;
+        }
+        for (int v = 0; v < n; v++)
+            in_offset_[v+1] += in_offset_[v];
+
+        in_edges_.resize(in_offset_[n]);
+        std::vector<int> next(in_offset_.begin(), in_offset_.end() - 1);
+        for (int v = 0; v < n; v++) {
+            for (auto e: graph_.get_adj_list(v))
+                in_edges_[next[e->other(v)]++] = {v, e->weight()};
+        }
+    }
+};
+
+/**
+ * @brief 基于队列的Bellman-Ford算法(SPFA: Shortest Path Faster Algorithm), 允许负权重
+ *
+ * 只把距离变小的顶点放入先进先出队列, 每次取出一个顶点松弛它的出边. 队列中的顶点不重复放入.
+ * 在稀疏图和负权重很少的图上通常比按轮松弛所有边快得多, 但最坏情况下仍是O(VE).
+ *
+ * 负环检测使用摊还的前驱图检查: 每做V次成功的松弛就在前驱图中查找一次环,
+ * 检查的代价被松弛操作摊还; 找到的环一定是负环.
+ *
+ * @tparam Graph 图类型, weight::sparse_multi_graph或weight::dense_graph
+ */
+template <typename Graph>
+class SPFA {
+private:
+    const Graph &graph_;
+    std::unique_ptr<shortest_path_workspace> own_ws_;
+    shortest_path_workspace &ws_;   // 距离和前驱顶点
+    std::deque<int> queue_;         // 距离变小, 等待松弛出边的顶点
+    std::vector<char> in_queue_;    // 顶点是否在队列中
+    std::vector<int> cycle_;        // 找到的负环
+    long long relax_count_ = 0;     // 最近一次搜索成功的松弛次数
+    uint32_t epoch_ = 0;            // 最近一次搜索时工作区的代数
+
+public:
+    SPFA(const Graph &graph):
+        graph_(graph), own_ws_(std::make_unique<shortest_path_workspace>()), ws_(*own_ws_)
+    {
+    }
+
+    /**
+     * @brief 构造一个使用外部工作区的SPFA对象
+     *
+     * @param graph 图
+     * @param ws 工作区, 可以与其他最短路径对象共享
+     */
+    SPFA(const Graph &graph, shortest_path_workspace &ws): graph_(graph), ws_(ws)
+    {
+    }
+
+    /**
+     * @brief 计算从s到所有顶点的最短路径
+     *
+     * 如果从s可以到达负环, 找到负环后立即停止, 这时的距离没有意义.
+     *
+     * @param s 起点
+     */
+    void search(int s)
+    {
+        int n = graph_.vertex_count();
+        ws_.reset(n);
+        epoch_ = ws_.epoch();
+        queue_.clear();
+        in_queue_.assign(n, 0);
+        cycle_.clear();
+        relax_count_ = 0;
+
+        ws_.update(s, 0, -1);
+        queue_.push_back(s);
+        in_queue_[s] = 1;
+
+        while (!queue_.empty()) {
+            int v = queue_.front();
+            queue_.pop_front();
+            in_queue_[v] = 0;
+
+            double dv = ws_.distance(v);
+            for (auto e: graph_.get_adj_list(v)) {
+                int w = e->other(v);
+                double dw = dv + e->weight();
+                if (dw >= ws_.distance(w))
+                    continue;
+
+                ws_.update(w, dw, v);
+                if (++relax_count_ % n == 0) {
+                    cycle_ = find_parent_cycle(n, [this](int u) {
+                        return ws_.is_reached(u) ? ws_.parent(u) : -1;
+                    });
+                    if (!cycle_.empty())
+                        return;
+                }
+                if (!in_queue_[w]) {
+                    in_queue_[w] = 1;
+                    queue_.push_back(w);
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief 最近一次搜索中是否找到了负环
+     *
+     * @return 如果从起点可以到达负环, 返回true, 否则返回false
+     */
+    bool has_negative_cycle() const { return !cycle_.empty(); }
+
+    /**
+     * @brief 最近一次搜索找到的负环
+     *
+     * @return 环上的顶点, 按边的方向排列(最后一个顶点有一条边指向第一个顶点); 没有负环时为空
+     */
+    const std::vector<int> &negative_cycle() const { return cycle_; }
+
+    /**
+     * @brief 顶点到起点的最短距离
+     *
+     * @param v 顶点
+     *
+     * @return 距离, 不可达, 或者共享工作区的其他对象查询之后为shortest_path_workspace::infinity
+     */
+    double distance(int v) const
+    {
+        return is_current() ? ws_.distance(v) : shortest_path_workspace::infinity;
+    }
+
+    /**
+     * @brief 是否存在从起点到v的路径
+     *
+     * @param v 顶点
+     *
+     * @return 如果可达, 返回true, 否则返回false; 共享工作区的其他对象查询之后总是返回false
+     */
+    bool has_path_to(int v) const { return is_current() && ws_.is_reached(v); }
+
+    /**
+     * @brief 从起点到t的最短路径
+     *
+     * @param t 终点
+     *
+     * @return 路径上的顶点(包括起点和终点), t不可达, 有负环, 或者共享工作区的其他对象查询之后为空
+     */
+    std::vector<int> path_to(int t) const
+    {
+        return has_negative_cycle() || !is_current() ? std::vector<int>() : ws_.path_to(t);
+    }
+
+    /**
+     * @brief 最近一次搜索成功的松弛次数
+     *
+     * @return 次数
+     */
+    long long relax_count() const { return relax_count_; }
+
+private:
+    /**
+     * @brief 工作区中的距离是否仍然属于本对象最近一次的搜索
+     */
+    bool is_current() const { return epoch_ != 0 && ws_.epoch() == epoch_; }
+};
+
+}   // namespace weight
+
+#endif
@@ -0,0 +1,647 @@
+/**
+ * @file weight_graph_contraction_hierarchy.hpp
+ * @brief 收缩层次(Contraction Hierarchies): 多线程的预处理和双向向上查询
+ * @author hexu_1985@sina.com
+ * @version 1.0
+ * @date 2020-10-15
+ *
+ * @see Geisberger, Sanders, Schultes, Delling: Contraction hierarchies: faster and simpler
+ * hierarchical routing in road networks (2008)
+ * @see Vetter: Parallel time-dependent contraction hierarchies (2009)
+ */
+#ifndef WEIGHT_GRAPH_CONTRACTION_HIERARCHY_INC
+#define WEIGHT_GRAPH_CONTRACTION_HIERARCHY_INC
+
+#include <vector>
+#include <cstdint>
+#include <utility>
+#include <algorithm>
+#include "parallel_utils.hpp"
+#include "weight_heap.hpp"
+#include "weight_shortest_path_workspace.hpp"
+
+namespace weight {
+
+/**
+ * @brief 收缩层次
+ *
+ * 预处理时按某种顺序逐个收缩(删除)顶点: 删除v时, 对v的每个入邻居a和出邻居b,
+ * 如果a->v->b是a到b的唯一最短路径, 就加入一条捷径(shortcut) a->b, 权重为两条边的权重之和,
+ * 这样剩下的图中任意两个顶点之间的距离都不变. 判断是否需要捷径的局部Dijkstra搜索叫做见证搜索
+ * (witness search), 找到不经过v且不更长的路径就不需要捷径.
+ *
+ * 顶点的顺序(rank)就是收缩的顺序, 原来的边和捷径都从低rank顶点指向高rank顶点的叫做向上边.
+ * 任意两个顶点之间都有一条先向上再向下的最短路径, 所以查询只需要从起点沿向上边、
+ * 从终点沿反向的向上边各做一次很小的Dijkstra搜索.
+ *
+ * 收缩的顺序用边差(edge difference)启发式规则选择: 收缩v需要加入的捷径数减去v的边数,
+ * 再加上v已经被收缩的邻居数, 使收缩均匀地分布在图上. 每一轮选出优先级比两步以内的顶点都小的顶点,
+ * 它们两两不相邻, 可以同时收缩: 优先级的计算、独立集的选择和见证搜索都在线程池中并行执行.
+ * 同一轮收缩的顶点的见证路径不经过本轮收缩的任何顶点, 所以各自的捷径可以独立地计算.
+ *
+ * 预处理的结果是两个CSR格式的数组: 每个顶点的向上出边和向上入边, 各自连续存放.
+ */
+class contraction_hierarchy {
+public:
+    /**
+     * @brief 向上边
+     */
+    struct arc {
+        int to;         // 另一端的顶点, rank比这个顶点高
+        int middle;     // 捷径跳过的顶点, 原来的边为-1
+        double weight;  // 权重
+    };
+
+private:
+    int v_cnt_ = 0;                     // 顶点数
+    std::vector<int> rank_;             // 每个顶点的收缩顺序
+    std::vector<int> up_offset_;        // 顶点v的向上出边为up_arcs_[up_offset_[v], up_offset_[v+1])
+    std::vector<arc> up_arcs_;          // v->to, rank(to) > rank(v)
+    std::vector<int> down_offset_;      // 顶点v的向上入边为down_arcs_[down_offset_[v], down_offset_[v+1])
+    std::vector<arc> down_arcs_;        // to->v, rank(to) > rank(v)
+    int shortcut_count_ = 0;            // 捷径的条数
+    int round_count_ = 0;               // 预处理的轮数
+    int witness_limit_ = 500;           // 每次见证搜索最多完成的顶点数
+
+    // 预处理时的动态图
+    struct work_graph;
+
+public:
+    contraction_hierarchy() = default;
+
+    /**
+     * @brief 设置见证搜索的规模
+     *
+     * 见证搜索完成了limit个顶点还没有找到见证路径时就加入捷径. 这不影响查询结果的正确性,
+     * limit越小预处理越快, 但多余的捷径会使查询变慢.
+     *
+     * @param limit 每次见证搜索最多完成的顶点数
+     */
+    void set_witness_limit(int limit) { witness_limit_ = std::max(1, limit); }
+
+    /**
+     * @brief 对图做预处理, 创建自己的线程池
+     *
+     * @tparam Graph 图类型, weight::sparse_multi_graph或weight::dense_graph
+     * @param graph 图, 权重必须非负
+     * @param thread_count 线程个数, 小于1时使用硬件支持的并发线程数
+     */
+    template <typename Graph>
+    void build(const Graph &graph, int thread_count = 0)
+    {
+        parallel::thread_pool pool(thread_count);
+        build(graph, pool);
+    }
+
+    /**
+     * @brief 对图做预处理, 使用外部的线程池
+     *
+     * @tparam Graph 图类型, weight::sparse_multi_graph或weight::dense_graph
+     * @param graph 图, 权重必须非负
+     * @param pool 线程池
+     */
+    template <typename Graph>
+    void build(const Graph &graph, parallel::thread_pool &pool)
+    {
+        work_graph g(graph.vertex_count());
+        for (int v = 0; v < graph.vertex_count(); v++) {
+            for (auto e: graph.get_adj_list(v)) {
+                int w = e->other(v);
+                if (w != v)
+                    g.add_arc(v, w, e->weight(), -1);
+            }
+        }
+        contract(g, pool);
+    }
+
+    /**
+     * @brief 顶点数
+     *
+     * @return 预处理时图的顶点数
+     */
+    int vertex_count() const { return v_cnt_; }
+
+    /**
+     * @brief 顶点的rank, 也就是收缩的顺序
+     *
+     * @param v 顶点
+     *
+     * @return rank, 在[0, V)之间
+     */
+    int rank(int v) const { return rank_[v]; }
+
+    /**
+     * @brief 加入的捷径的条数
+     *
+     * 捷径都是有向的, 无向图中一条捷径在两个方向上各算一条.
+     *
+     * @return 条数
+     */
+    int shortcut_count() const { return shortcut_count_; }
+
+    /**
+     * @brief 预处理的轮数, 每一轮同时收缩一个独立集
+     *
+     * @return 轮数
+     */
+    int round_count() const { return round_count_; }
+
+    /**
+     * @brief 向上边的条数(包括捷径)
+     *
+     * @return 向上出边和向上入边的条数之和
+     */
+    int arc_count() const { return static_cast<int>(up_arcs_.size() + down_arcs_.size()); }
+
+    /**
+     * @brief 顶点的向上出边
+     *
+     * @param v 顶点
+     *
+     * @return 边的区间[first, last)
+     */
+    std::pair<const arc *, const arc *> up_arcs(int v) const
+    {
+        return std::make_pair(up_arcs_.data() + up_offset_[v], up_arcs_.data() + up_offset_[v+1]);
+    }
+
+    /**
+     * @brief 顶点的向上入边, 边的to为起点
+     *
+     * @param v 顶点
+     *
+     * @return 边的区间[first, last)
+     */
+    std::pair<const arc *, const arc *> down_arcs(int v) const
+    {
+        return std::make_pair(down_arcs_.data() + down_offset_[v],
+                down_arcs_.data() + down_offset_[v+1]);
+    }
+
+    /**
+     * @brief 把边u->w展开成原图中的路径, 把u之后的顶点依次加入path
+     *
+     * @param u 边的起点
+     * @param w 边的终点
+     * @param middle 捷径跳过的顶点, 原来的边为-1
+     * @param path 路径
+     */
+    void unpack(int u, int w, int middle, std::vector<int> &path) const
+    {
+        if (middle == -1) {
+            path.push_back(w);
+            return;
+        }
+        // middle的rank比u和w都低, u->middle是middle的向上入边, middle->w是middle的向上出边
+        unpack(u, middle, find_arc(down_arcs(middle), u)->middle, path);
+        unpack(middle, w, find_arc(up_arcs(middle), w)->middle, path);
+    }
+
+private:
+    static const arc *find_arc(std::pair<const arc *, const arc *> arcs, int to)
+    {
+        return std::find_if(arcs.first, arcs.second, [to](const arc &a) { return a.to == to; });
+    }
+
+    /**
+     * @brief 预处理时的动态图: 每个顶点的出边和入边, 平行边只保留权重最小的一条
+     */
+    struct work_graph {
+        std::vector<std::vector<arc>> out;      // v->to
+        std::vector<std::vector<arc>> in;       // to->v
+
+        explicit work_graph(int v_cnt): out(v_cnt), in(v_cnt) {}
+
+        static bool update(std::vector<arc> &arcs, int to, double weight, int middle)
+        {
+            for (auto &a: arcs) {
+                if (a.to == to) {
+                    if (weight >= a.weight)
+                        return false;
+                    a.weight = weight;
+                    a.middle = middle;
+                    return true;
+                }
+            }
+            arcs.push_back({to, middle, weight});
+            return true;
+        }
+
+        bool add_arc(int u, int w, double weight, int middle)
+        {
+            if (!update(out[u], w, weight, middle))
+                return false;
+            update(in[w], u, weight, middle);
+            return true;
+        }
+
+        static void remove(std::vector<arc> &arcs, int to)
+        {
+            arcs.erase(std::remove_if(arcs.begin(), arcs.end(),
+                        [to](const arc &a) { return a.to == to; }), arcs.end());
+        }
+    };
+
+    struct shortcut {
+        int from;
+        int to;
+        double weight;
+        int middle;
+    };
+
+    /**
+     * @brief 每个线程的见证搜索
+     */
+    struct witness_search {
+        shortest_path_workspace ws;
+        binary_heap heap;
+        std::vector<uint32_t> target;       // 等于target_epoch的顶点是本次搜索的目标
+        uint32_t target_epoch = 0;
+        std::vector<shortcut> shortcuts;    // 本轮找到的捷径
+        std::vector<int> selected;          // 本轮选出的顶点
+    };
+
+    /**
+     * @brief 从a出发在剩下的图中做局部Dijkstra搜索, 不经过v和已收缩的顶点
+     *
+     * @param targets 目标顶点数, 所有目标都完成后就停止
+     * @param max_dist 距离超过max_dist的顶点不需要搜索
+     */
+    void witness_dijkstra(const work_graph &g, const std::vector<char> &contracted,
+            witness_search &search, int a, int v, int targets, double max_dist) const
+    {
+        auto &ws = search.ws;
+        auto &heap = search.heap;
+        ws.reset(v_cnt_);
+        heap.clear(v_cnt_);
+        ws.update(a, 0, -1);
+        heap.push(a, 0);
+
+        int settled = 0;
+        while (!heap.empty()) {
+            auto [d, x] = heap.pop();
+            if (d > ws.distance(x))
+                continue;
+            if (d > max_dist || ++settled > witness_limit_)
+                break;
+            if (search.target[x] == search.target_epoch && --targets == 0)
+                break;
+            for (auto &e: g.out[x]) {
+                if (e.to == v || contracted[e.to])
+                    continue;
+                double dw = d + e.weight;
+                if (dw < ws.distance(e.to)) {
+                    ws.update(e.to, dw, x);
+                    heap.push(e.to, dw);
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief 收缩v需要的捷径, 对每条捷径调用f(a, b, weight)
+     */
+    template <typename Func>
+    void find_shortcuts(const work_graph &g, const std::vector<char> &contracted,
+            witness_search &search, int v, Func f) const
+    {
+        if (g.in[v].empty() || g.out[v].empty())
+            return;
+
+        if ((int) search.target.size() < v_cnt_)
+            search.target.resize(v_cnt_, 0);
+        double max_out = 0;
+        for (auto &e: g.out[v])
+            max_out = std::max(max_out, e.weight);
+
+        for (auto &in: g.in[v]) {
+            int a = in.to;
+            // 目标是v的出邻居中除a以外的顶点
+            if (++search.target_epoch == 0) {
+                std::fill(search.target.begin(), search.target.end(), 0);
+                search.target_epoch = 1;
+            }
+            int targets = 0;
+            for (auto &out: g.out[v]) {
+                if (out.to != a) {
+                    search.target[out.to] = search.target_epoch;
+                    targets++;
+                }
+            }
+            if (targets == 0)
+                continue;
+            witness_dijkstra(g, contracted, search, a, v, targets, in.weight + max_out);
+            for (auto &out: g.out[v]) {
+                int b = out.to;
+                if (b == a)
+                    continue;
+                // 搜索中的距离都是真实存在的路径长度, 没有完成的顶点也可以作为见证
+                double weight = in.weight + out.weight;
+                if (search.ws.distance(b) > weight)
+                    f(a, b, weight);
+            }
+        }
+    }
+
+    static uint32_t mix(uint32_t x)
+    {
+        x ^= x >> 16;
+        x *= 0x7feb352dU;
+        x ^= x >> 15;
+        x *= 0x846ca68bU;
+        x ^= x >> 16;
+        return x;
+    }
+
+    /**
+     * @brief 按(优先级, 随机值, 编号)比较两个顶点, 随机值避免同优先级的顶点按编号成片地被收缩
+     */
+    static bool before(const std::vector<int> &priority, int v, int w)
+    {
+        if (priority[v] != priority[w])
+            return priority[v] < priority[w];
+        uint32_t hv = mix(v), hw = mix(w);
+        return hv != hw ? hv < hw : v < w;
+    }
+
+    void contract(work_graph &g, parallel::thread_pool &pool)
+    {
+        int n = static_cast<int>(g.out.size());
+        int thread_count = pool.size();
+        v_cnt_ = n;
+        rank_.assign(n, -1);
+        shortcut_count_ = 0;
+        round_count_ = 0;
+
+        std::vector<witness_search> searches(thread_count);
+        std::vector<char> contracted(n, 0);
+        std::vector<int> priority(n, 0);
+        std::vector<int> deleted_neighbors(n, 0);
+        std::vector<int> seen(n, -1);          // 最近一次把顶点计为已收缩邻居的被收缩顶点
+        std::vector<int> queued(n, 0);         // 顶点最近一次加入dirty的轮数
+
+        std::vector<int> remaining(n);
+        for (int v = 0; v < n; v++)
+            remaining[v] = v;
+        std::vector<int> dirty = remaining;     // 需要重新计算优先级的顶点
+        std::vector<int> selected;
+
+        auto neighbors = [&g](int v, auto f) {
+            for (auto &e: g.out[v])
+                f(e.to);
+            for (auto &e: g.in[v])
+                f(e.to);
+        };
+
+        int next_rank = 0;
+        while (!remaining.empty()) {
+            round_count_++;
+
+            // 1. 并行地重新计算优先级: 边差的两倍 + 已收缩的邻居数
+            parallel::parallel_for(pool, 0, static_cast<int>(dirty.size()), [&](int tid, int i) {
+                int v = dirty[i];
+                int added = 0;
+                find_shortcuts(g, contracted, searches[tid], v,
+                        [&added](int, int, double) { added++; });
+                int degree = static_cast<int>(g.out[v].size() + g.in[v].size());
+                priority[v] = 2 * (added - degree) + deleted_neighbors[v];
+            });
+
+            // 2. 并行地选出优先级比两步以内的所有顶点都小的顶点, 它们组成一个独立集.
+            //    只要求比相邻顶点小也可以, 但同时收缩的顶点太密时顶点的顺序变差, 捷径更多
+            parallel::parallel_for(pool, 0, static_cast<int>(remaining.size()), [&](int tid, int i) {
+                int v = remaining[i];
+                bool local_min = true;
+                neighbors(v, [&](int w) {
+                    if (!local_min || !(local_min = before(priority, v, w)))
+                        return;
+                    neighbors(w, [&](int x) {
+                        local_min = local_min && (x == v || before(priority, v, x));
+                    });
+                });
+                if (local_min)
+                    searches[tid].selected.push_back(v);
+            });
+            selected.clear();
+            for (auto &search: searches) {
+                selected.insert(selected.end(), search.selected.begin(), search.selected.end());
+                search.selected.clear();
+            }
+
+            // 3. 并行地做见证搜索. 见证路径不能经过本轮收缩的任何顶点, 这样各顶点的捷径互不依赖
+            for (int v: selected)
+                contracted[v] = 1;
+            parallel::parallel_for(pool, 0, static_cast<int>(selected.size()), [&](int tid, int i) {
+                int v = selected[i];
+                auto &shortcuts = searches[tid].shortcuts;
+                find_shortcuts(g, contracted, searches[tid], v, [&](int a, int b, double weight) {
+                    shortcuts.push_back({a, b, weight, v});
+                });
+            });
+
+            // 4. 删除收缩的顶点, 它们剩下的边就是向上边, 然后加入捷径
+            for (int v: selected) {
+                rank_[v] = next_rank++;
+                for (auto &e: g.out[v])
+                    work_graph::remove(g.in[e.to], v);
+                for (auto &e: g.in[v])
+                    work_graph::remove(g.out[e.to], v);
+            }
+            for (auto &search: searches) {
+                for (auto &s: search.shortcuts) {
+                    if (g.add_arc(s.from, s.to, s.weight, s.middle))
+                        shortcut_count_++;
+                }
+                search.shortcuts.clear();
+            }
+
+            // 被收缩顶点的邻居的优先级需要更新, 同一轮中多个被收缩顶点的公共邻居只加入一次
+            dirty.clear();
+            for (int v: selected) {
+                neighbors(v, [&](int w) {
+                    if (seen[w] == v)
+                        return;
+                    seen[w] = v;
+                    deleted_neighbors[w]++;
+                    if (queued[w] != round_count_) {
+                        queued[w] = round_count_;
+                        dirty.push_back(w);
+                    }
+                });
+            }
+            remaining.erase(std::remove_if(remaining.begin(), remaining.end(),
+                        [&](int v) { return contracted[v]; }), remaining.end());
+        }
+
+        to_csr(g.out, up_offset_, up_arcs_);
+        to_csr(g.in, down_offset_, down_arcs_);
+    }
+
+    static void to_csr(std::vector<std::vector<arc>> &lists, std::vector<int> &offset,
+            std::vector<arc> &arcs)
+    {
+        int n = static_cast<int>(lists.size());
+        offset.assign(n + 1, 0);
+        for (int v = 0; v < n; v++)
+            offset[v+1] = offset[v] + static_cast<int>(lists[v].size());
+        arcs.clear();
+        arcs.reserve(offset[n]);
+        for (auto &list: lists) {
+            arcs.insert(arcs.end(), list.begin(), list.end());
+            std::vector<arc>().swap(list);
+        }
+    }
+};
+
+/**
+ * @brief 收缩层次上的点对点最短路径查询
+ *
+ * 从起点沿向上出边、从终点沿向上入边交替做Dijkstra搜索, 两个方向都到达的顶点中
+ * 距离之和最小的就是最短路径的最高点. 一个方向的最小键值不小于当前最短距离时这个方向就结束了.
+ * 搜索使用stall-on-demand: 如果可以从一个rank更高的已到达顶点沿向下边以更短的距离到达v,
+ * v的距离就不是最短的, 不需要扩展v的边.
+ *
+ * @tparam Heap 优先队列类型, 参见weight_heap.hpp
+ */
+template <typename Heap = binary_heap>
+class CH {
+private:
+    const contraction_hierarchy &ch_;
+    shortest_path_workspace ws_[2];     // 正向和反向搜索的距离和前驱顶点
+    Heap heap_[2];                      // 正向和反向搜索的优先队列
+    int meet_ = -1;                     // 最近一次查询的最短路径的最高点
+    int target_ = -1;                   // 最近一次查询的终点
+    int settled_count_ = 0;
+
+public:
+    /**
+     * @brief 构造查询对象
+     *
+     * @param ch 预处理得到的收缩层次
+     */
+    CH(const contraction_hierarchy &ch): ch_(ch)
+    {
+    }
+
+    /**
+     * @brief 计算从s到t的最短路径
+     *
+     * @param s 起点
+     * @param t 终点
+     *
+     * @return s到t的最短距离, 不可达时为shortest_path_workspace::infinity
+     */
+    double search(int s, int t)
+    {
+        int n = ch_.vertex_count();
+        target_ = t;
+        meet_ = -1;
+        settled_count_ = 0;
+        for (int dir = 0; dir < 2; dir++) {
+            ws_[dir].reset(n);
+            heap_[dir].clear(n);
+        }
+
+        double best = shortest_path_workspace::infinity;
+        ws_[0].update(s, 0, -1);
+        heap_[0].push(s, 0);
+        ws_[1].update(t, 0, -1);
+        heap_[1].push(t, 0);
+
+        for (int dir = 0; !heap_[0].empty() || !heap_[1].empty(); dir = 1 - dir) {
+            if (heap_[dir].empty())
+                continue;
+            auto [d, v] = heap_[dir].pop();
+            if (d >= best) {
+                // 这个方向不会再找到更短的路径
+                heap_[dir].clear(n);
+                continue;
+            }
+            if (d > ws_[dir].distance(v))
+                continue;
+
+            settled_count_++;
+            double total = d + ws_[1-dir].distance(v);
+            if (total < best) {
+                best = total;
+                meet_ = v;
+            }
+            if (stalled(dir, v, d))
+                continue;
+
+            auto [first, last] = dir == 0 ? ch_.up_arcs(v) : ch_.down_arcs(v);
+            for (auto e = first; e != last; ++e) {
+                double dw = d + e->weight;
+                if (dw < ws_[dir].distance(e->to)) {
+                    ws_[dir].update(e->to, dw, v);
+                    heap_[dir].push(e->to, dw);
+                }
+            }
+        }
+
+        return best;
+    }
+
+    /**
+     * @brief 最近一次查询的最短路径, 捷径被展开成原图中的边
+     *
+     * @param t 最近一次查询的终点
+     *
+     * @return 路径上的顶点(包括起点和终点), 不可达或者t不是最近一次查询的终点时为空
+     */
+    std::vector<int> path_to(int t) const
+    {
+        std::vector<int> path;
+        if (meet_ == -1 || t != target_)
+            return path;
+
+        // 起点到最高点: 向上出边
+        std::vector<int> up = ws_[0].path_to(meet_);
+        path.push_back(up[0]);
+        for (size_t i = 1; i < up.size(); i++)
+            ch_.unpack(up[i-1], up[i], middle(ch_.up_arcs(up[i-1]), up[i]), path);
+
+        // 最高点到终点: 沿反向搜索的前驱顶点, 每条边都是前驱顶点的向上入边
+        for (int v = meet_; v != target_; ) {
+            int next = ws_[1].parent(v);
+            ch_.unpack(v, next, middle(ch_.down_arcs(next), v), path);
+            v = next;
+        }
+        return path;
+    }
+
+    /**
+     * @brief 最近一次查询完成(从优先队列中取出)的顶点数
+     *
+     * @return 两个方向的顶点数之和
+     */
+    int settled_count() const { return settled_count_; }
+
+private:
+    static int middle(std::pair<const contraction_hierarchy::arc *,
+            const contraction_hierarchy::arc *> arcs, int to)
+    {
+        for (auto e = arcs.first; e != arcs.second; ++e) {
+            if (e->to == to)
+                return e->middle;
+        }
+        return -1;
+    }
+
+    /**
+     * @brief stall-on-demand: 是否可以从rank更高的已到达顶点沿向下边以更短的距离到达v
+     */
+    bool stalled(int dir, int v, double d) const
+    {
+        auto [first, last] = dir == 0 ? ch_.down_arcs(v) : ch_.up_arcs(v);
+        for (auto e = first; e != last; ++e) {
+            if (ws_[dir].distance(e->to) + e->weight < d)
+                return true;
+        }
+        return false;
+    }
+};
+
+}   // namespace weight
+
+#endif
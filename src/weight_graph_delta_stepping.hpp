@@ -0,0 +1,409 @@
+/**
+ * @file weight_graph_delta_stepping.hpp
+ * @brief 多线程的单源最短路径Delta-stepping算法
+ * @author hexu_1985@sina.com
+ * @version 1.0
+ * @date 2020-10-13
+ *
+ * @see Meyer, Sanders: Delta-stepping: a parallelizable shortest path algorithm (2003)
+ */
+#ifndef WEIGHT_GRAPH_DELTA_STEPPING_INC
+#define WEIGHT_GRAPH_DELTA_STEPPING_INC
+
+#include <vector>
+#include <memory>
+#include <atomic>
+#include <limits>
+#include <algorithm>
+#include "parallel_utils.hpp"
+
+namespace weight {
+
+/**
+ * @brief 多线程的单源最短路径Delta-stepping算法
+ *
+ * 顶点按距离放入宽度为delta的桶中, 第i个桶包含距离在[i*delta, (i+1)*delta)之间的顶点.
+ * 按编号从小到大处理每个桶:
+ * 1. 反复松弛桶中顶点的轻边(权重不超过delta), 直到桶为空; 松弛可能把顶点重新放回这个桶;
+ * 2. 最后松弛这个桶中所有处理过的顶点的重边(权重大于delta), 它们只会进入后面的桶.
+ * 同一个桶中的顶点可以同时处理: 距离用原子的比较交换(compare-and-swap)取最小值,
+ * 成功减小距离的线程把顶点放入自己的桶, 一个阶段结束后合并各线程的桶, 与ParallelBFS的方式相同.
+ * 待处理的顶点的距离总是在[当前桶, 当前桶 + 最大权重]之间, 所以每个线程的桶是一个
+ * 长度约为最大权重/delta的循环数组, 超出这个范围的顶点暂存在溢出列表中,
+ * 占用的内存与桶的总数无关.
+ * delta = 0时退化为Dijkstra算法, delta = 无穷大时退化为Bellman-Ford算法.
+ * 所有边的权重必须非负.
+ *
+ * @tparam Graph 图类型, 例如weight::sparse_multi_graph
+ */
+template <typename Graph>
+class DeltaStepping {
+public:
+    /**
+     * @brief 不可达顶点的距离
+     */
+    static constexpr double infinity = std::numeric_limits<double>::infinity();
+
+private:
+    const Graph &graph_;
+    std::unique_ptr<parallel::thread_pool> own_pool_;
+    parallel::thread_pool &pool_;
+    std::vector<std::atomic<double>> dist_;             // 每个顶点到起点的距离
+    std::vector<std::atomic<size_t>> stamp_;            // 顶点最近一次被处理时所在的桶, 用于去重
+    std::vector<std::vector<std::vector<int>>> bins_;   // 每个线程的桶, 循环数组, 第b个桶为bins[b % ring_size_]
+    std::vector<std::vector<int>> far_;                 // 每个线程的溢出列表: 桶的编号不小于base_ + ring_size_的顶点
+    size_t ring_size_ = 1;                              // 循环数组的长度
+    size_t base_ = 0;                                   // 循环数组当前覆盖的桶为[base_, base_ + ring_size_)
+    std::vector<std::vector<int>> local_;               // 每个线程处理过的顶点
+    std::vector<int> frontier_;                         // 当前阶段要处理的顶点
+    std::vector<int> settled_;                          // 当前桶中处理过的顶点
+    double delta_ = 0;                                  // 桶的宽度, 0表示自动选择
+    double auto_delta_ = 0;                             // 自动选择的桶的宽度
+    double search_delta_ = 1;                           // 最近一次搜索实际使用的桶的宽度
+    double max_weight_ = 0;                             // 最大权重
+    int scanned_v_cnt_ = -1;                            // 统计权重时图的顶点数
+    int scanned_e_cnt_ = -1;                            // 统计权重时图的边数
+    int bucket_count_ = 0;                              // 最近一次搜索处理的非空桶的个数
+
+    static constexpr int chunk_size = 64;               // 每次领取的顶点个数
+    static constexpr size_t max_ring_size = 4096;       // 循环数组的最大长度
+    static constexpr double max_bucket = 4503599627370496.0;    // 桶编号的上限2^52, 可以用double和size_t精确表示
+
+public:
+    /**
+     * @brief 构造Delta-stepping对象, 创建自己的线程池
+     *
+     * @param graph 图
+     * @param thread_count 线程个数, 小于1时使用硬件支持的并发线程数
+     */
+    DeltaStepping(const Graph &graph, int thread_count = 0):
+        graph_(graph), own_pool_(std::make_unique<parallel::thread_pool>(thread_count)),
+        pool_(*own_pool_)
+    {
+    }
+
+    /**
+     * @brief 构造Delta-stepping对象, 使用外部的线程池
+     *
+     * @param graph 图
+     * @param pool 线程池
+     */
+    DeltaStepping(const Graph &graph, parallel::thread_pool &pool): graph_(graph), pool_(pool)
+    {
+    }
+
+    /**
+     * @brief 设置桶的宽度
+     *
+     * 搜索时桶的宽度至少为最大权重 * (V-1) / 2^52, 保证桶的编号不会溢出.
+     *
+     * @param delta 桶的宽度, 不大于0时自动选择
+     */
+    void set_delta(double delta) { delta_ = delta; }
+
+    /**
+     * @brief 搜索使用的桶的宽度
+     *
+     * 自动选择时为平均权重的两倍除以平均度数(Meyer-Sanders的启发式规则, 权重均匀分布时
+     * 就是最大权重除以平均度数), 这样每个顶点平均只有常数条轻边会在同一个桶中被重复松弛,
+     * 而每个桶中又有足够多的顶点可以并行处理. 使用平均权重而不是最大权重,
+     * 个别权重极大的边不会使delta变得过大; delta还不超过估计的最大距离的一半,
+     * 否则所有顶点都在同一个桶中, 退化为Bellman-Ford算法.
+     * 最大距离用从顶点0出发的BFS的层数乘以平均权重来估计, 与搜索的起点无关:
+     * 如果顶点0是孤立的或者在一个很小的连通分量中, 估计值偏小, delta也会偏小,
+     * 结果仍然正确, 但是桶的个数和同步的轮数会增加, 这时应该用set_delta()指定桶的宽度.
+     * 权重的统计在图的顶点数或边数变化时重新计算.
+     *
+     * @return 桶的宽度
+     */
+    double delta()
+    {
+        scan_graph();
+        return delta_ > 0 ? delta_ : auto_delta_;
+    }
+
+    /**
+     * @brief 计算从s到所有顶点的最短距离, 结果与Dijkstra算法相同
+     *
+     * @param s 起点
+     */
+    void search(int s)
+    {
+        int n = graph_.vertex_count();
+        int thread_count = pool_.size();
+        double delta = this->delta();
+        // 任何距离都不超过最大权重 * (V-1), 桶的编号不超过max_bucket
+        delta = std::max(delta, max_weight_ * std::max(n - 1, 0) / max_bucket);
+        search_delta_ = delta;
+
+        if ((int) dist_.size() != n) {
+            dist_ = std::vector<std::atomic<double>>(n);
+            stamp_ = std::vector<std::atomic<size_t>>(n);
+        }
+        parallel::parallel_for(pool_, 0, n, [&](int, int v) {
+            dist_[v].store(infinity, std::memory_order_relaxed);
+            stamp_[v].store(npos, std::memory_order_relaxed);
+        });
+        ring_size_ = static_cast<size_t>(std::min<double>(max_ring_size, max_weight_ / delta + 2));
+        base_ = 0;
+        bins_.resize(thread_count);
+        far_.resize(thread_count);
+        local_.resize(thread_count);
+        for (int i = 0; i < thread_count; i++) {
+            bins_[i].resize(ring_size_);
+            for (auto &bin: bins_[i])
+                bin.clear();
+            far_[i].clear();
+        }
+
+        dist_[s].store(0, std::memory_order_relaxed);
+        bins_[0][0].push_back(s);
+
+        bucket_count_ = 0;
+        for (size_t cur = 0; (cur = next_bucket(cur)) != npos; cur++) {
+            bucket_count_++;
+            settled_.clear();
+
+            // 反复处理当前桶中的顶点, 松弛它们的轻边, 直到桶为空
+            while (gather(cur, frontier_)) {
+                parallel::for_each_chunked(pool_, frontier_, chunk_size, [&](int v, int tid) {
+                    double dv = dist_[v].load(std::memory_order_relaxed);
+                    // 距离已经减小到前面的桶中, 说明已经处理过了
+                    if (bucket_of(dv, delta) != cur)
+                        return;
+                    if (stamp_[v].exchange(cur, std::memory_order_relaxed) != cur)
+                        local_[tid].push_back(v);
+                    relax_edges(v, dv, delta, tid, [delta](double w) { return w <= delta; });
+                });
+                for (auto &local: local_) {
+                    settled_.insert(settled_.end(), local.begin(), local.end());
+                    local.clear();
+                }
+            }
+
+            // 当前桶中的顶点的距离已经确定, 松弛它们的重边
+            parallel::for_each_chunked(pool_, settled_, chunk_size, [&](int v, int tid) {
+                double dv = dist_[v].load(std::memory_order_relaxed);
+                relax_edges(v, dv, delta, tid, [delta](double w) { return w > delta; });
+            });
+        }
+    }
+
+    /**
+     * @brief 最近一次搜索中顶点到起点的最短距离
+     *
+     * @param v 顶点
+     *
+     * @return 距离, 不可达时为infinity
+     */
+    double distance(int v) const { return dist_[v].load(std::memory_order_relaxed); }
+
+    /**
+     * @brief 最近一次搜索中v是否可以从起点到达
+     *
+     * @param v 顶点
+     *
+     * @return 如果可达, 返回true, 否则返回false
+     */
+    bool has_path_to(int v) const { return distance(v) != infinity; }
+
+    /**
+     * @brief 最近一次搜索处理的非空桶的个数, 也就是同步的轮数
+     *
+     * @return 个数
+     */
+    int bucket_count() const { return bucket_count_; }
+
+    /**
+     * @brief 线程池
+     *
+     * @return 搜索使用的线程池
+     */
+    parallel::thread_pool &pool() { return pool_; }
+
+private:
+    static constexpr size_t npos = static_cast<size_t>(-1);
+
+    /**
+     * @brief 距离所在的桶的编号
+     *
+     * search()选择的delta保证商不超过max_bucket, 这里再截断一次, 避免舍入误差使转换溢出.
+     */
+    static size_t bucket_of(double dist, double delta)
+    {
+        return static_cast<size_t>(std::min(dist / delta, max_bucket));
+    }
+
+    /**
+     * @brief 统计最大权重和平均权重, 并自动选择delta
+     *
+     * 只在图的顶点数或边数变化时重新计算.
+     */
+    void scan_graph()
+    {
+        int n = graph_.vertex_count();
+        if (n == scanned_v_cnt_ && graph_.edge_count() == scanned_e_cnt_)
+            return;
+        scanned_v_cnt_ = n;
+        scanned_e_cnt_ = graph_.edge_count();
+
+        std::vector<double> max_weight(pool_.size(), 0);
+        std::vector<double> sum_weight(pool_.size(), 0);
+        std::vector<long long> degree(pool_.size(), 0);
+        parallel::parallel_for(pool_, 0, n, [&](int tid, int v) {
+            for (auto e: graph_.get_adj_list(v)) {
+                max_weight[tid] = std::max(max_weight[tid], e->weight());
+                sum_weight[tid] += e->weight();
+                degree[tid]++;
+            }
+        });
+
+        max_weight_ = *std::max_element(max_weight.begin(), max_weight.end());
+        double sum = 0;
+        long long m = 0;
+        for (int i = 0; i < pool_.size(); i++) {
+            sum += sum_weight[i];
+            m += degree[i];
+        }
+        if (m == 0) {
+            auto_delta_ = 1.0;
+            return;
+        }
+
+        double avg_weight = sum / m;
+        double avg_degree = std::max(1.0, (double) m / n);
+        double delta = 2 * avg_weight / avg_degree;
+
+        // 最大距离的估计: 从顶点0出发的BFS的层数乘以平均权重
+        double max_dist = hop_eccentricity(0) * avg_weight;
+        delta = std::min(delta, max_dist / 2);
+        auto_delta_ = delta > 0 ? delta : (max_weight_ > 0 ? max_weight_ : 1.0);
+    }
+
+    /**
+     * @brief 从s出发的BFS的层数(不考虑权重)
+     */
+    int hop_eccentricity(int s)
+    {
+        int n = graph_.vertex_count();
+        std::vector<int> hops(n, -1);
+        std::vector<int> queue;
+        queue.reserve(n);
+        hops[s] = 0;
+        queue.push_back(s);
+        int last = 0;
+        for (size_t i = 0; i < queue.size(); i++) {
+            int v = queue[i];
+            last = hops[v];
+            for (auto e: graph_.get_adj_list(v)) {
+                int w = e->other(v);
+                if (hops[w] == -1) {
+                    hops[w] = last + 1;
+                    queue.push_back(w);
+                }
+            }
+        }
+        return std::max(last, 1);
+    }
+
+    /**
+     * @brief 松弛v的满足条件的出边, 距离减小的顶点放入线程tid的桶或者溢出列表中
+     */
+    template <typename Pred>
+    void relax_edges(int v, double dv, double delta, int tid, Pred pred)
+    {
+        auto &bins = bins_[tid];
+        auto &far = far_[tid];
+        for (auto e: graph_.get_adj_list(v)) {
+            double weight = e->weight();
+            if (!pred(weight))
+                continue;
+
+            int w = e->other(v);
+            double dw = dv + weight;
+            double old = dist_[w].load(std::memory_order_relaxed);
+            while (dw < old) {
+                if (dist_[w].compare_exchange_weak(old, dw, std::memory_order_relaxed)) {
+                    size_t b = bucket_of(dw, delta);
+                    if (b < base_ + ring_size_)
+                        bins[b % ring_size_].push_back(w);
+                    else
+                        far.push_back(w);
+                    break;
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief 所有线程的桶中不小于cur的第一个非空桶
+     *
+     * 循环数组覆盖的桶都为空时, 把循环数组移到溢出列表中最小的桶, 再把溢出列表中的顶点
+     * 放入循环数组. 溢出列表中距离已经减小到循环数组之前的顶点已经被处理过, 直接丢弃.
+     */
+    size_t next_bucket(size_t cur)
+    {
+        for (;;) {
+            size_t next = npos;
+            for (auto &bins: bins_) {
+                for (size_t b = cur; b < base_ + ring_size_ && b < next; b++) {
+                    if (!bins[b % ring_size_].empty()) {
+                        next = b;
+                        break;
+                    }
+                }
+            }
+            if (next != npos)
+                return next;
+
+            double delta = search_delta_;
+            size_t end = base_ + ring_size_;
+            size_t base = npos;
+            for (auto &far: far_) {
+                for (auto v: far) {
+                    size_t b = bucket_of(dist_[v].load(std::memory_order_relaxed), delta);
+                    if (b >= end)
+                        base = std::min(base, b);
+                }
+            }
+            if (base == npos)
+                return npos;
+
+            base_ = cur = base;
+            for (int tid = 0; tid < (int) far_.size(); tid++) {
+                auto &far = far_[tid];
+                size_t kept = 0;
+                for (auto v: far) {
+                    size_t b = bucket_of(dist_[v].load(std::memory_order_relaxed), delta);
+                    if (b < end)
+                        continue;
+                    if (b < base_ + ring_size_)
+                        bins_[tid][b % ring_size_].push_back(v);
+                    else
+                        far[kept++] = v;
+                }
+                far.resize(kept);
+            }
+        }
+    }
+
+    /**
+     * @brief 把各线程的第b个桶合并到out中, 并清空它们
+     *
+     * @return 如果out不为空, 返回true
+     */
+    bool gather(size_t b, std::vector<int> &out)
+    {
+        out.clear();
+        for (auto &bins: bins_) {
+            auto &bin = bins[b % ring_size_];
+            out.insert(out.end(), bin.begin(), bin.end());
+            bin.clear();
+        }
+        return !out.empty();
+    }
+};
+
+}   // namespace weight
+
+#endif
@@ -0,0 +1,242 @@
+/**
+ * @file weight_graph_dijkstra.hpp
+ * @brief 单源最短路径的Dijkstra算法, 可以选择优先队列
+ * @author hexu_1985@sina.com
+ * @version 1.0
+ * @date 2020-10-12
+ */
+#ifndef WEIGHT_GRAPH_DIJKSTRA_INC
+#define WEIGHT_GRAPH_DIJKSTRA_INC
+
+#include <vector>
+#include <memory>
+#include <type_traits>
+#include "weight_heap.hpp"
+#include "weight_shortest_path_workspace.hpp"
+
+namespace weight {
+
+/**
+ * @brief 单源最短路径的Dijkstra算法
+ *
+ * 每次从优先队列中取出距离最小的未完成顶点v, v的距离就是最终的最短距离;
+ * 然后松弛v的所有出边(v,w): 如果dist(v) + w(v,w) < dist(w), 更新w的距离和前驱顶点.
+ * 所有边的权重必须非负.
+ *
+ * 距离和前驱顶点保存在可以重复使用的工作区中, 每次查询只需O(1)时间重置;
+ * 优先队列也在多次查询之间重复使用. 点对点查询在终点完成时立即停止,
+ * 代价只与距离比终点更近的顶点有关.
+ *
+ * @tparam Graph 图类型, weight::sparse_multi_graph或weight::dense_graph
+ * @tparam Heap 优先队列类型, binary_heap, dary_heap<D>或radix_heap(只适用于整数权重,
+ * 图中有非整数或负的权重时改用binary_heap)
+ */
+template <typename Graph, typename Heap = binary_heap>
+class Dijkstra {
+private:
+    const Graph &graph_;
+    std::unique_ptr<shortest_path_workspace> own_ws_;
+    shortest_path_workspace &ws_;   // 距离和前驱顶点
+    Heap heap_;                     // 优先队列
+    int source_ = -1;               // 最近一次查询的起点
+    int settled_count_ = 0;         // 最近一次查询完成的顶点数
+    uint32_t epoch_ = 0;            // 最近一次查询时工作区的代数
+
+    // 只用于radix_heap: 权重不能用于基数堆时改用的优先队列
+    binary_heap fallback_heap_;
+    bool integer_weights_ = false;  // 所有权重是否都可以用于基数堆
+    int scanned_v_cnt_ = -1;        // 检查权重时图的顶点数
+    int scanned_e_cnt_ = -1;        // 检查权重时图的边数
+
+    static constexpr bool is_radix = std::is_same_v<Heap, radix_heap>;
+
+public:
+    Dijkstra(const Graph &graph):
+        graph_(graph), own_ws_(std::make_unique<shortest_path_workspace>()), ws_(*own_ws_)
+    {
+    }
+
+    /**
+     * @brief 构造一个使用外部工作区的Dijkstra对象
+     *
+     * @param graph 图
+     * @param ws 工作区, 可以与其他最短路径对象共享
+     */
+    Dijkstra(const Graph &graph, shortest_path_workspace &ws): graph_(graph), ws_(ws)
+    {
+    }
+
+    /**
+     * @brief 计算从s到所有顶点的最短路径
+     *
+     * @param s 起点
+     */
+    void search(int s)
+    {
+        run(s, -1);
+    }
+
+    /**
+     * @brief 计算从s到t的最短路径, t完成时立即停止
+     *
+     * 停止时所有距离小于dist(t)的顶点也已经完成, 它们的distance()和path_to()同样有效.
+     *
+     * @param s 起点
+     * @param t 终点
+     *
+     * @return s到t的最短距离, 不可达时为shortest_path_workspace::infinity
+     */
+    double search(int s, int t)
+    {
+        run(s, t);
+        return ws_.distance(t);
+    }
+
+    /**
+     * @brief 最近一次查询的起点
+     *
+     * @return 起点
+     */
+    int source() const { return source_; }
+
+    /**
+     * @brief 最近一次查询中顶点到起点的最短距离
+     *
+     * @param v 顶点
+     *
+     * @return 距离, 不可达, 或者共享工作区的其他对象查询之后为shortest_path_workspace::infinity
+     */
+    double distance(int v) const
+    {
+        return is_current() ? ws_.distance(v) : shortest_path_workspace::infinity;
+    }
+
+    /**
+     * @brief 最近一次查询中v是否可以从起点到达
+     *
+     * @param v 顶点
+     *
+     * @return 如果可达, 返回true, 否则返回false; 共享工作区的其他对象查询之后总是返回false
+     */
+    bool has_path_to(int v) const { return is_current() && ws_.is_reached(v); }
+
+    /**
+     * @brief 最近一次查询中v在最短路径树中的前驱顶点
+     *
+     * @param v 可达的顶点
+     *
+     * @return 前驱顶点, 起点, 或者共享工作区的其他对象查询之后为-1
+     */
+    int parent(int v) const { return is_current() ? ws_.parent(v) : -1; }
+
+    /**
+     * @brief 最近一次查询中从起点到t的一条最短路径
+     *
+     * @param t 终点
+     *
+     * @return 路径上的顶点(包括起点和终点), t不可达, 或者共享工作区的其他对象查询之后为空
+     */
+    std::vector<int> path_to(int t) const
+    {
+        return is_current() ? ws_.path_to(t) : std::vector<int>();
+    }
+
+    /**
+     * @brief 最近一次查询完成(从优先队列中取出)的顶点数
+     *
+     * @return 顶点数
+     */
+    int settled_count() const { return settled_count_; }
+
+    /**
+     * @brief 最近一次查询是否使用了Heap以外的优先队列
+     *
+     * @return Heap为radix_heap并且图中有不能用于基数堆的权重时返回true, 否则返回false
+     */
+    bool uses_fallback_heap() const { return is_radix && scanned_v_cnt_ != -1 && !integer_weights_; }
+
+private:
+    /**
+     * @brief 工作区中的距离是否仍然属于本对象最近一次的查询
+     */
+    bool is_current() const { return epoch_ != 0 && ws_.epoch() == epoch_; }
+
+    void run(int s, int t)
+    {
+        if constexpr (is_radix) {
+            scan_graph();
+            if (!integer_weights_) {
+                run(fallback_heap_, s, t);
+                return;
+            }
+        }
+        run(heap_, s, t);
+    }
+
+    /**
+     * @brief 检查所有权重是否都可以用于基数堆
+     *
+     * 只在图的顶点数或边数变化时重新检查.
+     */
+    void scan_graph()
+    {
+        int n = graph_.vertex_count();
+        if (n == scanned_v_cnt_ && graph_.edge_count() == scanned_e_cnt_)
+            return;
+        scanned_v_cnt_ = n;
+        scanned_e_cnt_ = graph_.edge_count();
+
+        integer_weights_ = true;
+        double total = 0;
+        for (int v = 0; v < n && integer_weights_; v++) {
+            for (auto e: graph_.get_adj_list(v)) {
+                total += e->weight();
+                if (!radix_heap::is_valid_weight(e->weight(), total)) {
+                    integer_weights_ = false;
+                    break;
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief 使用优先队列heap计算从s开始的最短路径, t完成时立即停止(t为-1时不停止)
+     */
+    template <typename H>
+    void run(H &heap, int s, int t)
+    {
+        int n = graph_.vertex_count();
+        ws_.reset(n);
+        epoch_ = ws_.epoch();
+        heap.clear(n);
+        source_ = s;
+        settled_count_ = 0;
+
+        ws_.update(s, 0, -1);
+        heap.push(s, 0);
+
+        while (!heap.empty()) {
+            auto [d, v] = heap.pop();
+            // 延迟删除: 跳过距离已经变小的旧元素
+            if (d > ws_.distance(v))
+                continue;
+
+            settled_count_++;
+            if (v == t)
+                break;
+
+            for (auto e: graph_.get_adj_list(v)) {
+                int w = e->other(v);
+                double dw = d + e->weight();
+                if (dw < ws_.distance(w)) {
+                    ws_.update(w, dw, v);
+                    heap.push(w, dw);
+                }
+            }
+        }
+    }
+};
+
+}   // namespace weight
+
+#endif
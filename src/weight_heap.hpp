@@ -0,0 +1,250 @@
+/**
+ * @file weight_heap.hpp
+ * @brief 最短路径算法使用的优先队列: 二叉堆, 支持decrease-key的d叉堆, 整数权重的基数堆
+ * @author hexu_1985@sina.com
+ * @version 1.0
+ * @date 2020-10-12
+ */
+#ifndef WEIGHT_HEAP_INC
+#define WEIGHT_HEAP_INC
+
+#include <vector>
+#include <cmath>
+#include <cassert>
+#include <cstdint>
+#include <utility>
+#include <algorithm>
+#include <functional>
+#include "bit_utils.hpp"
+
+namespace weight {
+
+/**
+ * @brief 二叉堆, 不支持decrease-key
+ *
+ * 顶点的键值变小时直接插入一个新的元素, 旧的元素留在堆中, 取出时由调用者根据距离数组跳过
+ * (延迟删除). 实现最简单, 每个元素只有一个(键值, 顶点)对, 缓存友好.
+ *
+ * 所有优先队列都提供相同的接口:
+ * - clear(v_cnt): 开始一次新的查询, v_cnt为图的顶点数
+ * - push(v, key): 插入顶点v, 或者把v的键值减小为key
+ * - pop(): 删除并返回键值最小的(键值, 顶点)对
+ * - empty(): 是否为空
+ */
+class binary_heap {
+private:
+    std::vector<std::pair<double, int>> heap_;  // (键值, 顶点)
+
+public:
+    void clear(int) { heap_.clear(); }
+
+    bool empty() const { return heap_.empty(); }
+
+    int size() const { return static_cast<int>(heap_.size()); }
+
+    void push(int v, double key)
+    {
+        heap_.emplace_back(key, v);
+        std::push_heap(heap_.begin(), heap_.end(), std::greater<std::pair<double, int>>());
+    }
+
+    std::pair<double, int> pop()
+    {
+        std::pop_heap(heap_.begin(), heap_.end(), std::greater<std::pair<double, int>>());
+        auto top = heap_.back();
+        heap_.pop_back();
+        return top;
+    }
+};
+
+/**
+ * @brief 支持decrease-key的d叉堆
+ *
+ * 记录每个顶点在堆中的位置, 键值变小时原地上移, 堆中每个顶点最多出现一次.
+ * d > 2时树的高度更低, 上移(插入和decrease-key)更快, 适合decrease-key很多的图;
+ * 下移时要比较更多的子结点, 但它们在内存中是连续的.
+ *
+ * @tparam D 每个结点的子结点个数
+ */
+template <int D = 4>
+class dary_heap {
+    static_assert(D >= 2, "dary_heap needs at least two children per node");
+
+private:
+    std::vector<std::pair<double, int>> heap_;  // (键值, 顶点)
+    std::vector<int> pos_;                      // 每个顶点在堆中的位置, 不在堆中为-1
+
+public:
+    void clear(int v_cnt)
+    {
+        // 只需要重置上次查询提前结束时留在堆中的顶点
+        for (auto &item: heap_)
+            pos_[item.second] = -1;
+        heap_.clear();
+        if ((int) pos_.size() < v_cnt)
+            pos_.resize(v_cnt, -1);
+    }
+
+    bool empty() const { return heap_.empty(); }
+
+    int size() const { return static_cast<int>(heap_.size()); }
+
+    /**
+     * @brief 顶点是否在堆中
+     *
+     * @param v 顶点
+     *
+     * @return 如果在堆中, 返回true, 否则返回false
+     */
+    bool contains(int v) const { return pos_[v] >= 0; }
+
+    void push(int v, double key)
+    {
+        int i = pos_[v];
+        if (i < 0) {
+            i = static_cast<int>(heap_.size());
+            heap_.emplace_back(key, v);
+        } else if (key < heap_[i].first) {
+            heap_[i].first = key;
+        } else {
+            return;
+        }
+        sift_up(i);
+    }
+
+    std::pair<double, int> pop()
+    {
+        auto top = heap_.front();
+        pos_[top.second] = -1;
+        auto last = heap_.back();
+        heap_.pop_back();
+        if (!heap_.empty()) {
+            heap_[0] = last;
+            sift_down(0);
+        }
+        return top;
+    }
+
+private:
+    void sift_up(int i)
+    {
+        auto item = heap_[i];
+        while (i > 0) {
+            int parent = (i - 1) / D;
+            if (!(item.first < heap_[parent].first))
+                break;
+            heap_[i] = heap_[parent];
+            pos_[heap_[i].second] = i;
+            i = parent;
+        }
+        heap_[i] = item;
+        pos_[item.second] = i;
+    }
+
+    void sift_down(int i)
+    {
+        auto item = heap_[i];
+        int n = static_cast<int>(heap_.size());
+        for (;;) {
+            int first = i * D + 1;
+            if (first >= n)
+                break;
+            int last = std::min(first + D, n);
+            int child = first;
+            for (int c = first + 1; c < last; c++) {
+                if (heap_[c].first < heap_[child].first)
+                    child = c;
+            }
+            if (!(heap_[child].first < item.first))
+                break;
+            heap_[i] = heap_[child];
+            pos_[heap_[i].second] = i;
+            i = child;
+        }
+        heap_[i] = item;
+        pos_[item.second] = i;
+    }
+};
+
+/**
+ * @brief 基数堆(radix heap), 只适用于非负整数权重的单调优先队列
+ *
+ * Dijkstra算法取出的键值单调不减, 插入的键值不小于最近一次取出的键值last.
+ * 键值为k的元素放在第b个桶中, b为k与last的最高不同位的位置(k = last时b = 0).
+ * 取出时如果第0个桶为空, 找到第一个非空的桶, 把last更新为其中的最小键值, 再把它的元素
+ * 重新分配到更低的桶中. 每个元素最多被重新分配64次, 插入为O(1), 取出均摊为O(log C).
+ * 与binary_heap一样使用延迟删除. 键值必须是非负整数, 否则会被截断而得到错误的距离;
+ * Dijkstra<Graph, radix_heap>在图中有不满足is_valid_weight()的权重时改用binary_heap.
+ */
+class radix_heap {
+private:
+    static constexpr int bucket_count = 65;
+
+    std::vector<std::pair<uint64_t, int>> buckets_[bucket_count];   // (键值, 顶点)
+    uint64_t last_ = 0;                                             // 最近一次取出的键值
+    int size_ = 0;                                                  // 元素个数
+
+    int bucket_of(uint64_t key) const
+    {
+        return key == last_ ? 0 : bits::word_bits - bits::count_leading_zeros(key ^ last_);
+    }
+
+public:
+    /**
+     * @brief 权重是否可以用于基数堆: 非负整数, 并且所有权重之和也能用double精确表示
+     *
+     * @param weight 一条边的权重
+     * @param total 所有权重之和
+     *
+     * @return 如果可以, 返回true, 否则返回false
+     */
+    static bool is_valid_weight(double weight, double total)
+    {
+        return weight >= 0 && weight == std::floor(weight) && total < 9007199254740992.0;    // 2^53
+    }
+
+    void clear(int)
+    {
+        for (auto &bucket: buckets_)
+            bucket.clear();
+        last_ = 0;
+        size_ = 0;
+    }
+
+    bool empty() const { return size_ == 0; }
+
+    int size() const { return size_; }
+
+    void push(int v, double key)
+    {
+        assert(key >= 0 && key == std::floor(key) && "radix_heap needs non-negative integer keys");
+        uint64_t k = static_cast<uint64_t>(key);
+        buckets_[bucket_of(k)].emplace_back(k, v);
+        size_++;
+    }
+
+    std::pair<double, int> pop()
+    {
+        if (buckets_[0].empty()) {
+            int b = 1;
+            while (buckets_[b].empty())
+                b++;
+
+            // 最小键值成为新的last, 这个桶中的元素都移到更低的桶中
+            auto &bucket = buckets_[b];
+            last_ = std::min_element(bucket.begin(), bucket.end())->first;
+            for (auto &item: bucket)
+                buckets_[bucket_of(item.first)].push_back(item);
+            bucket.clear();
+        }
+
+        auto top = buckets_[0].back();
+        buckets_[0].pop_back();
+        size_--;
+        return {static_cast<double>(top.first), top.second};
+    }
+};
+
+}   // namespace weight
+
+#endif
@@ -0,0 +1,143 @@
+/**
+ * @file weight_shortest_path_workspace.hpp
+ * @brief 最短路径算法可以重复使用的工作区: 距离数组和前驱数组
+ * @author hexu_1985@sina.com
+ * @version 1.0
+ * @date 2020-10-12
+ */
+#ifndef WEIGHT_SHORTEST_PATH_WORKSPACE_INC
+#define WEIGHT_SHORTEST_PATH_WORKSPACE_INC
+
+#include <vector>
+#include <limits>
+#include <cstdint>
+#include <algorithm>
+
+namespace weight {
+
+/**
+ * @brief 最短路径算法可以重复使用的工作区
+ *
+ * 距离和前驱顶点保存在两个长度为V的连续数组中. 与unweight::traversal_workspace一样,
+ * 每个顶点记录它被到达时的代数(epoch), 只有等于当前代数的顶点的距离有效,
+ * 开始一次新的查询只需要把当前代数加1, 不需要O(V)的清零.
+ */
+class shortest_path_workspace {
+private:
+    std::vector<double> dist_;      // 每个顶点到起点的距离
+    std::vector<int> parent_;       // 每个顶点在最短路径树中的前驱顶点, 起点为-1
+    std::vector<uint32_t> mark_;    // 每个顶点被到达时的代数
+    uint32_t epoch_ = 0;            // 当前代数
+
+public:
+    /**
+     * @brief 不可达顶点的距离
+     */
+    static constexpr double infinity = std::numeric_limits<double>::infinity();
+
+    /**
+     * @brief 构造一个工作区
+     *
+     * @param v_cnt 顶点数, 可以为0, 第一次reset()时再分配
+     */
+    explicit shortest_path_workspace(int v_cnt = 0)
+    {
+        reset(v_cnt);
+    }
+
+    /**
+     * @brief 开始一次新的查询: 把所有顶点标记为不可达
+     *
+     * 除了顶点数增加或代数溢出时需要重新分配或清零, 时间复杂度为O(1).
+     *
+     * @param v_cnt 图的顶点数
+     */
+    void reset(int v_cnt)
+    {
+        if ((int) mark_.size() < v_cnt) {
+            mark_.resize(v_cnt, 0);
+            dist_.resize(v_cnt);
+            parent_.resize(v_cnt);
+        }
+
+        if (++epoch_ == 0) {
+            // 代数溢出, 清除所有旧的标记
+            std::fill(mark_.begin(), mark_.end(), 0);
+            epoch_ = 1;
+        }
+    }
+
+    /**
+     * @brief 当前代数
+     *
+     * 共享工作区的最短路径对象可以记下自己查询时的代数, 之后与当前代数比较,
+     * 判断工作区中的距离是否仍然属于自己的查询.
+     *
+     * @return 代数, 每次reset()之后改变
+     */
+    uint32_t epoch() const { return epoch_; }
+
+    /**
+     * @brief 顶点在本次查询中是否已经到达
+     *
+     * @param v 顶点
+     *
+     * @return 如果已经到达, 返回true, 否则返回false
+     */
+    bool is_reached(int v) const { return mark_[v] == epoch_; }
+
+    /**
+     * @brief 顶点到起点的距离
+     *
+     * @param v 顶点
+     *
+     * @return 距离, 不可达时为infinity
+     */
+    double distance(int v) const { return is_reached(v) ? dist_[v] : infinity; }
+
+    /**
+     * @brief 顶点在最短路径树中的前驱顶点
+     *
+     * @param v 已到达的顶点
+     *
+     * @return 前驱顶点, 起点为-1
+     */
+    int parent(int v) const { return parent_[v]; }
+
+    /**
+     * @brief 更新顶点的距离和前驱顶点, 并把它标记为已到达
+     *
+     * @param v 顶点
+     * @param dist 距离
+     * @param parent 前驱顶点
+     */
+    void update(int v, double dist, int parent)
+    {
+        mark_[v] = epoch_;
+        dist_[v] = dist;
+        parent_[v] = parent;
+    }
+
+    /**
+     * @brief 沿前驱顶点得到从起点到t的路径
+     *
+     * @param t 终点
+     *
+     * @return 路径上的顶点(包括起点和终点), t不可达时为空
+     */
+    std::vector<int> path_to(int t) const
+    {
+        std::vector<int> path;
+        if (!is_reached(t))
+            return path;
+
+        for (int v = t; v != -1; v = parent_[v])
+            path.push_back(v);
+        std::reverse(path.begin(), path.end());
+        return path;
+    }
+};
+
+}   // namespace weight
+
+#endif